@@ -0,0 +1,208 @@
+// LCD_Benchmark.ino
+//
+// Speed of the library helpers, measured on the target and shown on the
+// screen and on Serial, in microseconds per call.
+//
+// Formatters: the buffer versions of i32toa(), htoa() and ttoa(), integer only
+// and without allocation, against sprintf() and the String versions.
+//
+// Trigonometry: the Q15 table functions, atan2Angle() and isqrt32(), against
+// the former piecewise-linear cos32x100(), with the largest error of each one
+// compared to the floating-point cos().
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include "Energia.h"
+#include <stdio.h>
+#include <math.h>
+
+// Screen selection
+#define K35_PARALLEL // EB-LM4F120-L35
+
+#include "Screen_K35_Parallel.h"
+Screen_K35_Parallel myScreen;
+
+// Calls per measure
+#define LOOPS 1000
+
+char buffer[LCD_FORMAT_SIZE];
+// volatile, so the calls are not optimised away
+volatile int32_t value;
+volatile uint8_t length;
+
+uint32_t chrono;
+
+void start()
+{
+    chrono = micros();
+}
+
+// Time per call, in us with one decimal
+void report(const char *name)
+{
+    uint32_t elapsed = micros() - chrono;
+
+    i32toa(buffer, elapsed, LOOPS, 1, 8);
+    myScreen.print(name);
+    myScreen.println(buffer);
+    Serial.print(name);
+    Serial.println(buffer);
+}
+
+// Largest error, with one decimal
+void reportError(const char *name, float error)
+{
+    i32toa(buffer, (int32_t)(error * 10.0 + 0.5), 10, 1, 8);
+    myScreen.print(name);
+    myScreen.println(buffer);
+    Serial.print(name);
+    Serial.println(buffer);
+}
+
+// cos32x100() up to release 102: nine segments, for 0 to 90 degrees only
+int32_t cosPiecewise(int32_t degreesX100)
+{
+    if (degreesX100< 1000)      return map(degreesX100,    0, 1000, 100, 98);
+    else if (degreesX100< 2000) return map(degreesX100, 1000, 2000,  98, 93);
+    else if (degreesX100< 3000) return map(degreesX100, 2000, 3000,  93, 86);
+    else if (degreesX100< 4000) return map(degreesX100, 3000, 4000,  86, 76);
+    else if (degreesX100< 5000) return map(degreesX100, 4000, 5000,  76, 64);
+    else if (degreesX100< 6000) return map(degreesX100, 5000, 6000,  64, 50);
+    else if (degreesX100< 7000) return map(degreesX100, 6000, 7000,  50, 34);
+    else if (degreesX100< 8000) return map(degreesX100, 7000, 8000,  34, 17);
+    else                        return map(degreesX100, 8000, 9000,  17,  0);
+}
+
+void setup()
+{
+    Serial.begin(9600);
+    myScreen.begin();
+    myScreen.setFontSize(1);
+    myScreen.setTextColour(whiteColour, blackColour);
+    myScreen.setCursor(0, 0);
+    myScreen.println(F("Benchmark, us per call"));
+    myScreen.println();
+    Serial.println(F("Benchmark, us per call"));
+
+    // Integer, 8 characters wide
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = k * 12345;
+        length = sprintf(buffer, "%8ld", (long)value);
+    }
+    report("sprintf %8ld    ");
+
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = k * 12345;
+        length = i32toa(buffer, value, 1, 0, 8);
+    }
+    report("i32toa(buffer)  ");
+
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = k * 12345;
+        length = i32toa(value, 1, 0, 8).length();
+    }
+    report("i32toa String   ");
+
+    // Hundredths with 2 decimals
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = k * 12345;
+        length = sprintf(buffer, "%5ld.%02ld", (long)(value / 100), (long)(value % 100));
+    }
+    report("sprintf %ld.%02ld ");
+
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = k * 12345;
+        length = i32toa(buffer, value, 100, 2, 8);
+    }
+    report("i32toa 2 dec.   ");
+
+    // Hexadecimal
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = k * 12345;
+        length = sprintf(buffer, "%08lx", (unsigned long)value);
+    }
+    report("sprintf %08lx   ");
+
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = k * 12345;
+        length = htoa(buffer, value, 8);
+    }
+    report("htoa(buffer)    ");
+
+    // Duration
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = k * 12345;
+        length = ttoa(buffer, value, 8);
+    }
+    report("ttoa(buffer)    ");
+
+    myScreen.println();
+    Serial.println();
+
+    // Trigonometry, 0 to 90 degrees
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = cosPiecewise(k * 9);
+    }
+    report("cos piecewise   ");
+
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = cos32x100(k * 9);
+    }
+    report("cos32x100       ");
+
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = cosQ15(k * 16);
+    }
+    report("cosQ15          ");
+
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = atan2Angle(k, LOOPS - k);
+    }
+    report("atan2Angle      ");
+
+    start();
+    for (int32_t k = 0; k < LOOPS; k++) {
+        value = isqrt32(k * 12345);
+    }
+    report("isqrt32         ");
+
+    // Errors, in hundredths for x100, in LSB for Q15, in 1/100 degree for atan2
+    float errorPiecewise = 0.0;
+    float errorX100 = 0.0;
+    float errorQ15 = 0.0;
+    float errorAngle = 0.0;
+    for (int32_t k = 0; k <= 9000; k += 5) {
+        float c = cos(k * PI / 18000.0);
+        errorPiecewise = max(errorPiecewise, fabs(cosPiecewise(k) - 100.0 * c));
+        errorX100 = max(errorX100, fabs(cos32x100(k) - 100.0 * c));
+    }
+    for (int32_t k = 0; k <= 16384; k += 7) {
+        float c = cos(k * TWO_PI / 65536.0);
+        errorQ15 = max(errorQ15, fabs(cosQ15(k) - 32768.0 * c));
+        errorAngle = max(errorAngle, fabs(atan2Angle((int32_t)(10000.0 * sin(k * TWO_PI / 65536.0)), (int32_t)(10000.0 * c)) - (float)k));
+    }
+    reportError("err piecewise   ", errorPiecewise);
+    reportError("err cos32x100   ", errorX100);
+    reportError("err cosQ15 LSB  ", errorQ15);
+    reportError("err atan2 .01deg", errorAngle * 36000.0 / 65536.0);
+}
+
+void loop()
+{
+    delay(1000);
+}
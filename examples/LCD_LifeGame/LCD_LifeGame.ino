@@ -45,6 +45,9 @@
 // Updated 8/4/2022 by Andy4495 for compatibility with Kentec_35_Parallel library and building with Arduino IDE/CLI
 // https://github.com/Andy4495/Kentec_35_Parallel
 //
+// Bit-packed board, LifeBoard.h, one bit per cell: 80x60 cells on the MSP430F5529
+// One generation per tick of the scheduler, the board drawn at its own pace
+//
 
 #include "Energia.h"
 
@@ -52,35 +55,35 @@
 #define K35_PARALLEL // EB-LM4F120-L35
 
 #include "Screen_K35_Parallel.h"
+#include "LCD_cells.h"
+#include "LCD_scheduler.h"
+#include "LifeBoard.h"
 //Screen_K35_Parallel myScreen(Screen_K35_Parallel::F5529_INTERFACE_BOARD_INSTALLED, Screen_K35_Parallel::TOUCH_DISABLED);
 Screen_K35_Parallel myScreen;
 
 
-// Beware of RAM limitations
+// Board, one bit per cell, see LifeBoard.h
+// 80x60 takes 3,310 bytes on the MSP430F5529
 #if defined(__MSP430F5529__) || defined(__MSP432P401R__)
-#define ROWS 32 // max 80
-#define COLS 32 // max 60
-#elif defined(__LM4F120H5QR__) || defined(__TM4C123GH6PM__)
-#define ROWS 80 // max 80
-#define COLS 60 // max 60
-#elif defined(__TM4C1294NCPDT__) || defined(__TM4C1294XNCZAD__) || defined(__MSP432P401R__)
-#define ROWS 128 // max 128
-#define COLS 128 // max 128
+#define WIDTH  80 // 4x4 pixels
+#define HEIGHT 60
+#elif defined(__LM4F120H5QR__) || defined(__TM4C123GH6PM__) || defined(__TM4C1294NCPDT__) || defined(__TM4C1294XNCZAD__)
+#define WIDTH  160 // 2x2 pixels
+#define HEIGHT 120
 #else
 #error Board not supported
 #endif
 
 #define PERCENT 70 // % dead
 
-// bits 7 . 6 . 5 . 4 . 3 . 2 . 1 . 0
-// [3] = dead 0, alive 1
-// [2..0] = age 0-7
+#define TEXT_HEIGHT 12 // pixels, band of the generation and chrono fields, font 1
 
-#define ALIVE   0x08
-#define DEAD    0x00
+#define TICK  100000 // us, one generation
+#define FRAME 40000 // us, minimum period of the frames
 
-#define NMASK   0x08
-#define AGEMASK 0x07
+// Colour index of a cell
+// [3] = dead 0, alive 1, LIFE_ALIVE
+// [2..0] = age 0-7, LIFE_AGE
 
 //#define StopButton 28
 //#define NewGameButton 39
@@ -88,30 +91,93 @@ Screen_K35_Parallel myScreen;
 #define NewGameButton PUSH2
 
 // Define variables and constants
-uint8_t _screen[2][ROWS][COLS];
-uint32_t chrono;
-uint8_t page;
+lifeWord_t boardBuffer[LIFE_BUFFER(WIDTH, HEIGHT)];
+LifeBoard board;
+LCD_cells cells;
+LCD_scheduler scheduler;
+uint32_t chrono;                // calculation time of the last generation
 uint16_t colours[16];
 uint16_t generation;
-uint8_t rowSize, colSize;
+char generationText[8];         // strings on screen, for gTextUpdate()
+char chronoText[12];
+uint8_t cellSizeX, cellSizeY;
 uint8_t i, j;
 
+// Only the cells whose colour changed, from the change plane of the board,
+// merged into runs by the grid
+// The board keeps its own changes, across the generations not drawn: the rows
+// left when the next generation is due are drawn with the next frame.
+void render(const LCD_area *areas, uint8_t count)
+{
+    uint8_t indexes[WIDTH];
+    
+    for (uint16_t y = 0; y < HEIGHT; y++)
+    {
+        if (board.isRowChanged(y))
+        {
+            if (scheduler.timeLeft() == 0)
+            {
+                scheduler.invalidate(0, y*cellSizeY, WIDTH*cellSizeX, (HEIGHT-y)*cellSizeY);
+                return;
+            }
+            board.getRow(y, indexes);
+            cells.drawRow(y, indexes, (const uint8_t *)board.changedRow(y));
+            board.clearChanges(y);
+            
+            // the fields are on the board: a row drawn under them erases them
+            if ((y+1)*cellSizeY > myScreen.screenSizeY()-TEXT_HEIGHT)
+            {
+                generationText[0] = '\0';
+                chronoText[0] = '\0';
+            }
+        }
+    }
+    
+    // generation
+    myScreen.setFontSolid(true);
+    
+    // only the characters that changed are drawn
+    // formatted in a local buffer, without String
+    char text[LCD_FORMAT_SIZE];
+    myScreen.setFontSize(1);
+    i32toa(text, generation);
+    myScreen.gTextUpdate(0,
+                         myScreen.screenSizeY()-myScreen.fontSizeY(),
+                         text, generationText, sizeof(generationText));
+    
+    // calculation time in seconds
+    myScreen.setFontSize(0);
+    ttoa(text, chrono, 8);
+    myScreen.gTextUpdate(myScreen.screenSizeX()-8*myScreen.fontSizeX(),
+                         myScreen.screenSizeY()-myScreen.fontSizeY(),
+                         text, chronoText, sizeof(chronoText));
+}
+
+void next_generation()
+{
+    chrono = millis();
+    board.step();
+    chrono = millis() - chrono;
+    generation++;
+    scheduler.invalidate(0, 0, WIDTH*cellSizeX, HEIGHT*cellSizeY);
+}
+
 void new_game()
 {
-    page = 0;
-    for (i=0; i < ROWS; i++)
+    board.clear();
+    for (uint16_t y=0; y < HEIGHT; y++)
     {
-        for (j=0; j < COLS; j++)
+        for (uint16_t x=0; x < WIDTH; x++)
         {
-            if (random(100) > PERCENT)  _screen[page^1][i][j] = ALIVE;
-            else                        _screen[page^1][i][j] = DEAD;
-            myScreen.dRectangle(i*rowSize, j*colSize, rowSize, colSize, colours[_screen[page^1][i][j]]);
+            if (random(100) > PERCENT) board.setCell(x, y, true);
         }
     }
     
-    page ^= 1;
     generation = 0;
-    chrono = millis();
+    chrono = 0;
+    generationText[0] = '\0';
+    chronoText[0] = '\0';
+    scheduler.invalidate(0, 0, WIDTH*cellSizeX, HEIGHT*cellSizeY);
 }
 
 
@@ -123,8 +189,11 @@ void setup()
     
     myScreen.begin();
     
-    rowSize = myScreen.screenSizeX() / ROWS;
-    colSize = myScreen.screenSizeY() / COLS;
+    board.begin(boardBuffer, WIDTH, HEIGHT);
+    cellSizeX = myScreen.screenSizeX() / WIDTH;
+    cellSizeY = myScreen.screenSizeY() / HEIGHT;
+    cells.begin(&myScreen, 0, 0, WIDTH, HEIGHT, cellSizeX, cellSizeY);
+    cells.setPalette(colours);
     
     delay(10);
     myScreen.setPenSolid(true);
@@ -178,166 +247,16 @@ void setup()
     myScreen.clear();
     
     randomSeed(analogRead(0));
+    scheduler.begin(TICK, FRAME);
+    scheduler.addUpdate(next_generation);
+    scheduler.setRender(render);
     new_game();
 }
 
 
-void update_pixel(uint8_t i, uint8_t j, uint8_t neighbours)
-{
-    if (bitRead(_screen[page][i][j], 3))
-    {
-        // alive
-        if ((neighbours < 2) || (neighbours > 3))
-        {
-            _screen[page^1][i][j] = DEAD;   // zero age dead pixel      // 0 pass
-        }
-        else
-        {
-            _screen[page^1][i][j] = _screen[page][i][j] + 1;             // 8-15 living
-            if (_screen[page^1][i][j] > 0x0f)
-            {
-                _screen[page^1][i][j] = 0x0f;
-            }
-        }
-    }
-    else
-    {
-        // dead
-        if (neighbours == 3)
-        {
-            _screen[page^1][i][j] = ALIVE; // zero age alive pixel     // 8 born
-        } else {
-            _screen[page^1][i][j] = _screen[page][i][j] + 1;             // 0-7 dying
-            if (_screen[page^1][i][j] > 0x07) _screen[page^1][i][j] = 0x07;
-        }
-    }
-    
-    if (_screen[page][i][j]!=_screen[page^1][i][j])
-        myScreen.dRectangle(i*rowSize, j*colSize, rowSize, colSize, colours[_screen[page^1][i][j]]);
-}
-
 void loop()
 {
-    uint8_t neighbours;
-    
-    generation++;
-    
-    for (i=1; i < ROWS-1; i++)
-    {
-        for (j=1; j<COLS-1; j++)
-        {
-            neighbours  = bitRead(_screen[page][i-1][j-1], 3);
-            neighbours += bitRead(_screen[page][i-1][j  ], 3);
-            neighbours += bitRead(_screen[page][i-1][j+1], 3);
-            neighbours += bitRead(_screen[page][i  ][j-1], 3);
-            neighbours += bitRead(_screen[page][i  ][j+1], 3);
-            neighbours += bitRead(_screen[page][i+1][j-1], 3);
-            neighbours += bitRead(_screen[page][i+1][j  ], 3);
-            neighbours += bitRead(_screen[page][i+1][j+1], 3);
-            update_pixel(i,j, neighbours);
-        }
-    }
-    for (i=1; i < COLS-1; i++)
-    {
-        neighbours  = bitRead(_screen[page][0     ][i-1], 3);
-        neighbours += bitRead(_screen[page][0     ][i+1], 3);
-        neighbours += bitRead(_screen[page][1     ][i-1], 3);
-        neighbours += bitRead(_screen[page][1     ][i  ], 3);
-        neighbours += bitRead(_screen[page][1     ][i+1], 3);
-        neighbours += bitRead(_screen[page][ROWS-1][i-1], 3);
-        neighbours += bitRead(_screen[page][ROWS-1][i  ], 3);
-        neighbours += bitRead(_screen[page][ROWS-1][i+1], 3);
-        update_pixel(0, i, neighbours);
-        
-        neighbours  = bitRead(_screen[page][ROWS-2][i-1], 3);
-        neighbours += bitRead(_screen[page][ROWS-2][i  ], 3);
-        neighbours += bitRead(_screen[page][ROWS-2][i+1], 3);
-        neighbours += bitRead(_screen[page][ROWS-1][i-1], 3);
-        neighbours += bitRead(_screen[page][ROWS-1][i+1], 3);
-        neighbours += bitRead(_screen[page][0     ][i-1], 3);
-        neighbours += bitRead(_screen[page][0     ][i  ], 3);
-        neighbours += bitRead(_screen[page][0     ][i+1], 3);
-        update_pixel(ROWS-1,i, neighbours);
-    }
-    for (i=1; i < ROWS-1; i++)
-    {
-        neighbours  = bitRead(_screen[page][i-1][0     ], 3);
-        neighbours += bitRead(_screen[page][i+1][0     ], 3);
-        neighbours += bitRead(_screen[page][i-1][1     ], 3);
-        neighbours += bitRead(_screen[page][i  ][1     ], 3);
-        neighbours += bitRead(_screen[page][i+1][1     ], 3);
-        neighbours += bitRead(_screen[page][i-1][COLS-1], 3);
-        neighbours += bitRead(_screen[page][i  ][COLS-1], 3);
-        neighbours += bitRead(_screen[page][i+1][COLS-1], 3);
-        update_pixel(i, 0, neighbours);
-        
-        neighbours  = bitRead(_screen[page][i-1][COLS-1], 3);
-        neighbours += bitRead(_screen[page][i+1][COLS-1], 3);
-        neighbours += bitRead(_screen[page][i-1][COLS-2], 3);
-        neighbours += bitRead(_screen[page][i  ][COLS-2], 3);
-        neighbours += bitRead(_screen[page][i+1][COLS-2], 3);
-        neighbours += bitRead(_screen[page][i-1][0     ], 3);
-        neighbours += bitRead(_screen[page][i  ][0     ], 3);
-        neighbours += bitRead(_screen[page][i+1][0     ], 3);
-        update_pixel(i,COLS-1, neighbours);
-    }
-    
-    neighbours  = bitRead(_screen[page][1     ][0     ], 3);
-    neighbours += bitRead(_screen[page][1     ][1     ], 3);
-    neighbours += bitRead(_screen[page][0     ][1     ], 3);
-    neighbours += bitRead(_screen[page][ROWS-1][0     ], 3);
-    neighbours += bitRead(_screen[page][ROWS-1][1     ], 3);
-    neighbours += bitRead(_screen[page][ROWS-1][COLS-1], 3);
-    neighbours += bitRead(_screen[page][0     ][COLS-1], 3);
-    neighbours += bitRead(_screen[page][1     ][COLS-1], 3);
-    update_pixel(0,0, neighbours);
-    
-    neighbours  = bitRead(_screen[page][1     ][0     ], 3);
-    neighbours += bitRead(_screen[page][0     ][0     ], 3);
-    neighbours += bitRead(_screen[page][0     ][COLS-2], 3);
-    neighbours += bitRead(_screen[page][1     ][COLS-2], 3);
-    neighbours += bitRead(_screen[page][1     ][COLS-1], 3);
-    neighbours += bitRead(_screen[page][ROWS-1][COLS-1], 3);
-    neighbours += bitRead(_screen[page][ROWS-1][COLS-2], 3);
-    neighbours += bitRead(_screen[page][ROWS-1][0     ], 3);
-    update_pixel(0,COLS-1, neighbours);
-    
-    neighbours  = bitRead(_screen[page][ROWS-1][1     ], 3);
-    neighbours += bitRead(_screen[page][ROWS-2][0     ], 3);
-    neighbours += bitRead(_screen[page][ROWS-2][1     ], 3);
-    neighbours += bitRead(_screen[page][ROWS-1][COLS-1], 3);
-    neighbours += bitRead(_screen[page][ROWS-2][COLS-1], 3);
-    neighbours += bitRead(_screen[page][0     ][COLS-1], 3);
-    neighbours += bitRead(_screen[page][0     ][0     ], 3);
-    neighbours += bitRead(_screen[page][0     ][1     ], 3);
-    update_pixel(ROWS-1,0, neighbours);
-    
-    neighbours  = bitRead(_screen[page][ROWS-1][COLS-2], 3);
-    neighbours += bitRead(_screen[page][ROWS-2][COLS-2], 3);
-    neighbours += bitRead(_screen[page][ROWS-2][COLS-1], 3);
-    neighbours += bitRead(_screen[page][ROWS-1][0     ], 3);
-    neighbours += bitRead(_screen[page][ROWS-2][0     ], 3);
-    neighbours += bitRead(_screen[page][0     ][0     ], 3);
-    neighbours += bitRead(_screen[page][0     ][COLS-1], 3);
-    neighbours += bitRead(_screen[page][1     ][COLS-2], 3);
-    update_pixel(ROWS-1,COLS-1, neighbours);
-    
-    page ^= 1;
-    
-    // generation
-    myScreen.setFontSolid(true);
-    
-    myScreen.setFontSize(1);
-    myScreen.gText(0,
-                   myScreen.screenSizeY()-myScreen.fontSizeY(),
-                   i32toa(generation, 1, 0, 0));
-    
-    // calculation time in seconds
-    myScreen.setFontSize(0);
-    myScreen.gText(myScreen.screenSizeX()-8*myScreen.fontSizeX(),
-                   myScreen.screenSizeY()-myScreen.fontSizeY(),
-                   ttoa((millis()-chrono), 8));
-    chrono = millis();
+    scheduler.run();
     
     //    // touch to stop
     if (digitalRead(StopButton) == 0)
@@ -0,0 +1,332 @@
+// LifeBoard.cpp
+//
+// Bit-packed Game of Life engine for the LifeGame example
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+// Library header
+#include "LifeBoard.h"
+#include <string.h>
+
+// Tile: computed by this generation, and generations without change up to 7
+#define TILE_HOT        0x80
+#define TILE_QUIET      0x07
+
+// Code
+LifeBoard::LifeBoard()
+{
+    _state = _age0 = _age1 = _age2 = _changed = NULL;
+    _first = _previous = _next = NULL;
+    _width = _height = 0;
+    _words = _lastBit = 0;
+    _lastMask = 0;
+    _flips = _flipsTop = _flipsBottom = NULL;
+    _tiles = NULL;
+    _tileRows = 0;
+    _active = 0;
+}
+
+void LifeBoard::begin(lifeWord_t *buffer, uint16_t width, uint16_t height)
+{
+    uint16_t plane;
+
+    _width  = width;
+    _height = height;
+    _words  = LIFE_WORDS(width);
+    plane   = _height * _words;
+
+    _state    = buffer;
+    _age0     = _state + plane;
+    _age1     = _age0 + plane;
+    _age2     = _age1 + plane;
+    _changed  = _age2 + plane;
+    _first    = _changed + plane;
+    _previous = _first + _words;
+    _next     = _previous + _words;
+    _tileRows = (_height + LIFE_TILE - 1) / LIFE_TILE;
+    _flips    = _next + _words;
+    _flipsTop = _flips + _tileRows * _words;
+    _flipsBottom = _flipsTop + _tileRows * _words;
+    _tiles    = (uint8_t *)(_flipsBottom + _tileRows * _words);
+
+    // Cells of the last word, the bits above stay dead
+    _lastBit  = (_width - 1) % LIFE_BITS;
+    _lastMask = ((lifeWord_t)~0) >> (LIFE_BITS - 1 - _lastBit);
+    clear();
+}
+
+void LifeBoard::clear()
+{
+    uint16_t plane = _height * _words;
+
+    memset(_state, 0x00, 4 * plane * sizeof(lifeWord_t));
+    for (uint16_t y = 0; y < _height; y++) {
+        lifeWord_t *changed = _changed + y * _words;
+        for (uint8_t k = 0; k < _words; k++) changed[k] = (lifeWord_t)~0;
+        changed[_words - 1] = _lastMask;
+    }
+    for (uint16_t t = 0; t < 3 * _tileRows * _words; t++) _flips[t] = (lifeWord_t)~0;
+    memset(_tiles, 0x00, _tileRows * _words);
+}
+
+void LifeBoard::setCell(uint16_t x, uint16_t y, bool alive)
+{
+    uint16_t index = _index(x, y);
+    lifeWord_t bit = (lifeWord_t)1 << (x % LIFE_BITS);
+
+    if (alive) _state[index] |= bit;
+    else _state[index] &= ~bit;
+    _age0[index] &= ~bit;
+    _age1[index] &= ~bit;
+    _age2[index] &= ~bit;
+    _changed[index] |= bit;
+    _touch(x, y);
+}
+
+uint8_t LifeBoard::getCell(uint16_t x, uint16_t y)
+{
+    uint16_t index = _index(x, y);
+    uint8_t shift = x % LIFE_BITS;
+
+    return (((_state[index] >> shift) & 1) << 3) | (((_age2[index] >> shift) & 1) << 2) |
+           (((_age1[index] >> shift) & 1) << 1) | ((_age0[index] >> shift) & 1);
+}
+
+void LifeBoard::getRow(uint16_t y, uint8_t *indexes)
+{
+    uint16_t index = y * _words;
+
+    for (uint16_t x = 0; x < _width; index++) {
+        lifeWord_t state = _state[index];
+        lifeWord_t age0  = _age0[index];
+        lifeWord_t age1  = _age1[index];
+        lifeWord_t age2  = _age2[index];
+
+        for (uint8_t k = 0; (k < LIFE_BITS) && (x < _width); k++, x++) {
+            *indexes++ = ((state & 1) << 3) | ((age2 & 1) << 2) | ((age1 & 1) << 1) | (age0 & 1);
+            state >>= 1;
+            age0  >>= 1;
+            age1  >>= 1;
+            age2  >>= 1;
+        }
+    }
+}
+
+bool LifeBoard::isChanged(uint16_t x, uint16_t y)
+{
+    return (_changed[_index(x, y)] >> (x % LIFE_BITS)) & 1;
+}
+
+bool LifeBoard::isRowChanged(uint16_t y)
+{
+    const lifeWord_t *changed = _changed + y * _words;
+
+    for (uint8_t k = 0; k < _words; k++) {
+        if (changed[k] != 0) return true;
+    }
+    return false;
+}
+
+void LifeBoard::clearChanges()
+{
+    memset(_changed, 0x00, _height * _words * sizeof(lifeWord_t));
+}
+
+void LifeBoard::clearChanges(uint16_t y)
+{
+    memset(_changed + y * _words, 0x00, _words * sizeof(lifeWord_t));
+}
+
+const lifeWord_t *LifeBoard::changedRow(uint16_t y)
+{
+    return _changed + y * _words;
+}
+
+uint16_t LifeBoard::width()
+{
+    return _width;
+}
+
+uint16_t LifeBoard::height()
+{
+    return _height;
+}
+
+uint16_t LifeBoard::activeTiles()
+{
+    return _active;
+}
+
+// The row is computed into scratch, as its neighbours still need the current
+// state: the previous row and the first one are kept before being replaced.
+uint16_t LifeBoard::step()
+{
+    uint16_t count = 0;
+
+    _prepareTiles();
+    _copy(_first, _state);
+    _copy(_previous, _state + (_height - 1) * _words);
+
+    for (uint16_t y = 0; y < _height; y++) {
+        lifeWord_t *row = _state + y * _words;
+        const lifeWord_t *down = (y + 1 < _height) ? row + _words : _first;
+        uint8_t *tiles = _tiles + (y / LIFE_TILE) * _words;
+        lifeWord_t *flips = _flips + (y / LIFE_TILE) * _words;
+        lifeWord_t *top = (y % LIFE_TILE == 0) ? _flipsTop + (y / LIFE_TILE) * _words : NULL;
+        lifeWord_t *bottom = ((y % LIFE_TILE == LIFE_TILE - 1) || (y + 1 == _height)) ?
+                             _flipsBottom + (y / LIFE_TILE) * _words : NULL;
+
+        for (uint8_t k = 0; k < _words; k++) {
+            lifeWord_t a, b, c;
+
+            // Nothing changed around: same state
+            if ((tiles[k] & TILE_HOT) == 0) {
+                _next[k] = row[k];
+                continue;
+            }
+
+            // Row above: three cells summed into 2 bits, u0 + 2 u1
+            a = _west(_previous, k);
+            b = _previous[k];
+            c = _east(_previous, k);
+            lifeWord_t u0 = a ^ b ^ c;
+            lifeWord_t u1 = (a & b) | (c & (a ^ b));
+
+            // Same row, without the cell itself
+            a = _west(row, k);
+            c = _east(row, k);
+            lifeWord_t m0 = a ^ c;
+            lifeWord_t m1 = a & c;
+
+            // Row below
+            a = _west(down, k);
+            b = down[k];
+            c = _east(down, k);
+            lifeWord_t d0 = a ^ b ^ c;
+            lifeWord_t d1 = (a & b) | (c & (a ^ b));
+
+            // Units, and their carry joins the twos
+            lifeWord_t s0 = u0 ^ m0 ^ d0;
+            lifeWord_t s1 = (u0 & m0) | (d0 & (u0 ^ m0));
+
+            // Exactly one of the four twos: 2 or 3 neighbours
+            lifeWord_t p = u1 ^ m1;
+            lifeWord_t q = d1 ^ s1;
+            lifeWord_t two = (p ^ q) & ~((u1 & m1) | (d1 & s1));
+
+            // Born with 3, survives with 2 or 3
+            _next[k] = two & (s0 | row[k]);
+        }
+        _next[_words - 1] &= _lastMask;
+
+        for (uint8_t k = 0; k < _words; k++) {
+            uint16_t index = y * _words + k;
+
+            // Same state for 7 generations: all ages are 7
+            if (((tiles[k] & TILE_HOT) == 0) && ((tiles[k] & TILE_QUIET) == TILE_QUIET)) continue;
+
+            lifeWord_t flip = row[k] ^ _next[k];
+            lifeWord_t age0 = _age0[index];
+            lifeWord_t age1 = _age1[index];
+            lifeWord_t age2 = _age2[index];
+
+            // Age + 1 up to 7, and back to 0 when the state flips
+            lifeWord_t old  = age0 & age1 & age2;
+            lifeWord_t inc  = ~(flip | old);
+            lifeWord_t carry1 = age0 & inc;
+            lifeWord_t carry2 = age1 & carry1;
+            _age0[index] = (age0 ^ inc) & ~flip;
+            _age1[index] = (age1 ^ carry1) & ~flip;
+            _age2[index] = (age2 ^ carry2) & ~flip;
+
+            // Colour changes unless alive or dead since 7 generations
+            _changed[index] |= flip | ~old;
+            flips[k] |= flip;
+            if (top != NULL) top[k] = flip;
+            if (bottom != NULL) bottom[k] = flip;
+            for (lifeWord_t w = flip; w; w &= w - 1) count++;
+        }
+        _changed[y * _words + _words - 1] &= _lastMask;
+
+        _copy(_previous, row);
+        _copy(row, _next);
+    }
+
+    for (uint16_t t = 0; t < _tileRows * _words; t++) {
+        uint8_t quiet = _tiles[t] & TILE_QUIET;
+        if (_flips[t] != 0) _tiles[t] = 0;
+        else _tiles[t] = (quiet < TILE_QUIET) ? quiet + 1 : TILE_QUIET;
+    }
+    return count;
+}
+
+uint16_t LifeBoard::_index(uint16_t x, uint16_t y)
+{
+    return y * _words + x / LIFE_BITS;
+}
+
+// Each cell gets its left neighbour: cell x - 1 at the bit of x
+lifeWord_t LifeBoard::_west(const lifeWord_t *row, uint8_t k)
+{
+    lifeWord_t carry = (k > 0) ? row[k - 1] >> (LIFE_BITS - 1) : row[_words - 1] >> _lastBit;
+    return (row[k] << 1) | carry;
+}
+
+// Each cell gets its right neighbour: cell x + 1 at the bit of x
+lifeWord_t LifeBoard::_east(const lifeWord_t *row, uint8_t k)
+{
+    if (k + 1 < _words) return (row[k] >> 1) | ((row[k + 1] & 1) << (LIFE_BITS - 1));
+    return (row[k] >> 1) | ((row[0] & 1) << _lastBit);
+}
+
+// A cell set by the sketch counts as born or dead
+void LifeBoard::_touch(uint16_t x, uint16_t y)
+{
+    uint16_t tile = (y / LIFE_TILE) * _words + x / LIFE_BITS;
+
+    lifeWord_t bit = (lifeWord_t)1 << (x % LIFE_BITS);
+
+    _flips[tile] |= bit;
+    if (y % LIFE_TILE == 0) _flipsTop[tile] |= bit;
+    if ((y % LIFE_TILE == LIFE_TILE - 1) || (y + 1 == _height)) _flipsBottom[tile] |= bit;
+    _tiles[tile] = 0;
+}
+
+// Tiles to compute: those with a change in them, or next to their cells in the
+// tiles around: the row just above and below, the cells just left and right
+void LifeBoard::_prepareTiles()
+{
+    _active = 0;
+    for (uint8_t ty = 0; ty < _tileRows; ty++) {
+        lifeWord_t *above = _flipsBottom + ((ty > 0) ? ty - 1 : _tileRows - 1) * _words;
+        lifeWord_t *flips = _flips + ty * _words;
+        lifeWord_t *below = _flipsTop + ((ty + 1 < _tileRows) ? ty + 1 : 0) * _words;
+        uint8_t *tiles = _tiles + ty * _words;
+
+        for (uint8_t k = 0; k < _words; k++) {
+            uint8_t left  = (k > 0) ? k - 1 : _words - 1;
+            uint8_t right = (k + 1 < _words) ? k + 1 : 0;
+            lifeWord_t around = above[k] | flips[k] | below[k];
+            lifeWord_t west = above[left] | flips[left] | below[left];
+            lifeWord_t east = above[right] | flips[right] | below[right];
+
+            around |= (k > 0) ? west >> (LIFE_BITS - 1) : west >> _lastBit;
+            around |= east & 1;
+
+            tiles[k] &= ~TILE_HOT;
+            if (around != 0) {
+                tiles[k] |= TILE_HOT;
+                _active++;
+            }
+        }
+    }
+    memset(_flips, 0x00, 3 * _tileRows * _words * sizeof(lifeWord_t));
+}
+
+void LifeBoard::_copy(lifeWord_t *destination, const lifeWord_t *source)
+{
+    memcpy(destination, source, _words * sizeof(lifeWord_t));
+}
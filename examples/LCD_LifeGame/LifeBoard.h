@@ -0,0 +1,187 @@
+// LifeBoard.h
+//
+// Bit-packed Game of Life engine for the LifeGame example
+//
+// One bit per cell, packed along the rows in words of LIFE_BITS cells, lowest
+// bit on the left. A generation is computed a word at a time: the eight
+// neighbours are the row above, the row itself and the row below, each shifted
+// one cell left and right, and are summed with bitwise full adders, so all the
+// cells of a word are counted at once. The board is a torus: shifts carry
+// across words and wrap from the last cell of a row to the first one, and the
+// first row follows the last one.
+//
+// The age of each cell, 0 to 7 generations in its current state, is kept in
+// three bit planes, incremented with the same bitwise adders. A fourth plane
+// flags the cells whose colour, state and age, changed since the sketch last
+// cleared the flags, so only those are drawn again, even after several
+// generations without drawing.
+//
+// The board is divided into tiles, one word wide and LIFE_TILE rows high, each
+// with masks of the columns where cells were born or died: in the whole tile,
+// in its first row and in its last one. A cell only changes if one of its
+// neighbours changed with the previous generation, so a tile is computed again
+// only if it changed, or if the tiles around changed in the row or the column
+// next to its own cells.
+// The other tiles keep their state, and the ages of their cells go on for
+// up to 7 generations, after which the tile is skipped altogether: nothing is
+// computed and nothing is drawn for the still lifes and empty areas.
+//
+// The planes, three rows of scratch and the tiles are in a buffer statically
+// allocated by the caller: LIFE_BUFFER(width, height) words. An 80x60 board
+// takes 3,310 bytes on the MSP430, against 9,600 bytes for two pages of one
+// byte per cell.
+//
+// The engine uses no Arduino function, so extras/Tools/life_benchmark.cpp
+// compiles it on the host.
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#ifndef LIFE_BOARD_RELEASE
+///
+/// @brief	Release number
+///
+#define LIFE_BOARD_RELEASE 100
+
+#include <stdint.h>
+
+// Native word of the MCU: 16 cells on the MSP430, 32 otherwise
+#if defined(__MSP430__) || defined(LIFE_HOST_16)
+typedef uint16_t lifeWord_t;
+#define LIFE_BITS 16
+#else
+typedef uint32_t lifeWord_t;
+#define LIFE_BITS 32
+#endif
+
+///
+/// @brief	Words per row
+///
+#define LIFE_WORDS(width) (((width) + LIFE_BITS - 1) / LIFE_BITS)
+
+///
+/// @brief	Rows per tile
+///
+#define LIFE_TILE 8
+
+///
+/// @brief	Tiles, three words and one byte each
+///
+#define LIFE_TILES(width, height) (LIFE_WORDS(width) * (((height) + LIFE_TILE - 1) / LIFE_TILE))
+
+///
+/// @brief	Words of the buffer: state, three age planes and changes, three rows of scratch and the tiles
+///
+#define LIFE_BUFFER(width, height) ((5 * (height) + 3) * LIFE_WORDS(width) + 3 * LIFE_TILES(width, height) + (LIFE_TILES(width, height) + LIFE_BITS / 8 - 1) / (LIFE_BITS / 8))
+
+///
+/// @brief	Colour index of a cell: alive 8-15, dead 0-7, plus the age
+///
+#define LIFE_ALIVE 0x08
+#define LIFE_AGE   0x07
+
+///
+/// @brief      Board of the Game of Life, one bit per cell
+///
+class LifeBoard {
+public:
+
+    ///
+    /// @brief	Constructor
+    ///
+    LifeBoard();
+
+    ///
+    /// @brief	Set the board up and clear it
+    /// @param	buffer LIFE_BUFFER(width, height) words, statically allocated by the caller
+    /// @param	width cells per row
+    /// @param	height rows
+    ///
+    void begin(lifeWord_t *buffer, uint16_t width, uint16_t height);
+
+    ///
+    /// @brief	All cells dead, age 0, all flagged as changed
+    ///
+    void clear();
+
+    ///
+    /// @brief	Set a cell, with age 0, and flag it as changed
+    ///
+    void setCell(uint16_t x, uint16_t y, bool alive);
+
+    ///
+    /// @brief	Colour index of a cell
+    /// @return	LIFE_ALIVE if alive, plus the age 0-7
+    ///
+    uint8_t getCell(uint16_t x, uint16_t y);
+
+    ///
+    /// @brief	Colour indexes of a row
+    /// @param	y row
+    /// @param	indexes width bytes, LIFE_ALIVE if alive, plus the age 0-7
+    ///
+    void getRow(uint16_t y, uint8_t *indexes);
+
+    ///
+    /// @brief	Whether the colour index of a cell changed since the flags were cleared
+    ///
+    bool isChanged(uint16_t x, uint16_t y);
+
+    ///
+    /// @brief	Whether the colour index of any cell of a row changed since the flags were cleared
+    ///
+    bool isRowChanged(uint16_t y);
+
+    ///
+    /// @brief	Clear the flags of the changed cells, once drawn
+    ///
+    void clearChanges();
+
+    ///
+    /// @brief	Clear the flags of the changed cells of a row, once drawn
+    ///
+    void clearChanges(uint16_t y);
+
+    ///
+    /// @brief	Changes of a row, one bit per cell as the state
+    /// @note   Words are little-endian on the MSP430 and the ARM boards, so the row
+    ///         is also a mask of bytes, lowest bit first, for LCD_cells::drawRow().
+    ///
+    const lifeWord_t *changedRow(uint16_t y);
+
+    ///
+    /// @brief	Compute the next generation
+    /// @return	number of cells born or dead
+    ///
+    uint16_t step();
+
+    ///
+    /// @brief	Tiles computed by the last generation
+    ///
+    uint16_t activeTiles();
+
+    uint16_t width();
+    uint16_t height();
+
+private:
+    lifeWord_t *_state, *_age0, *_age1, *_age2, *_changed;
+    lifeWord_t *_first, *_previous, *_next;
+    uint16_t _width, _height;
+    uint8_t _words, _lastBit;
+    lifeWord_t _lastMask;
+    lifeWord_t *_flips, *_flipsTop, *_flipsBottom;
+    uint8_t *_tiles;
+    uint8_t _tileRows;
+    uint16_t _active;
+
+    uint16_t _index(uint16_t x, uint16_t y);
+    lifeWord_t _west(const lifeWord_t *row, uint8_t k);
+    lifeWord_t _east(const lifeWord_t *row, uint8_t k);
+    void _copy(lifeWord_t *destination, const lifeWord_t *source);
+    void _touch(uint16_t x, uint16_t y);
+    void _prepareTiles();
+};
+
+#endif
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+#
+# bdf_convert.py
+#
+# Convert a BDF bitmap font into a proportional LCD_font header, see src/LCD_font.h.
+#
+# Each glyph keeps its advance (DWIDTH) and its bounding box (BBX), placed in
+# a cell of FONT_ASCENT + FONT_DESCENT rows. Glyphs must fit the renderer:
+# 16 columns and 24 rows at most. A negative left bearing is removed by moving
+# the glyph right, and an ink box wider than the advance widens the advance,
+# so glyphs never overlap.
+#
+# Usage:
+#   python3 extras/Tools/bdf_convert.py font.bdf --name Helvetica10 --output Helvetica10.h
+#   python3 extras/Tools/bdf_convert.py font.bdf --name Helvetica10 --first 0x20 --last 0x7E
+#       ASCII only
+#
+# https://github.com/Andy4495/Kentec_35_Parallel
+# This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+# See LICENSE file at above github repository
+#
+
+import argparse
+import os
+import sys
+
+from font_compress import write_header
+
+MAX_WIDTH = 16
+MAX_HEIGHT = 24
+
+
+def read_bdf(filename):
+    """BDF file -> ascent, descent, {code: (advance, w, h, xoff, yoff, rows)}"""
+    ascent = descent = None
+    glyphs = {}
+    code = advance = box = None
+    rows = None
+    for line in open(filename, encoding="latin-1"):
+        words = line.split()
+        if not words:
+            continue
+        if rows is not None:
+            if words[0] == "ENDCHAR":
+                if code is not None and code >= 0:
+                    glyphs[code] = (advance,) + box + (rows,)
+                rows = None
+            else:
+                rows.append(int(words[0], 16))
+        elif words[0] == "FONT_ASCENT":
+            ascent = int(words[1])
+        elif words[0] == "FONT_DESCENT":
+            descent = int(words[1])
+        elif words[0] == "STARTCHAR":
+            code, advance, box = None, None, (0, 0, 0, 0)
+        elif words[0] == "ENCODING":
+            code = int(words[1])
+        elif words[0] == "DWIDTH":
+            advance = int(words[1])
+        elif words[0] == "BBX":
+            box = tuple(int(v) for v in words[1:5])
+        elif words[0] == "BITMAP":
+            rows = []
+    if ascent is None or descent is None:
+        raise ValueError("%s: FONT_ASCENT and FONT_DESCENT required" % filename)
+    return ascent, descent, glyphs
+
+
+def convert(ascent, descent, glyphs, first, last):
+    """-> width, height, {code: pixels}, {code: advance}"""
+    height = ascent + descent
+    if height > MAX_HEIGHT:
+        raise ValueError("font height %d, %d max" % (height, MAX_HEIGHT))
+    cells = dict((code, []) for code in range(first, last + 1))
+    advances = {}
+    for code in range(first, last + 1):
+        advance, w, h, xoff, yoff, rows = glyphs.get(code, (0, 0, 0, 0, 0, []))
+        left = max(xoff, 0)
+        if left + w > 2 * MAX_WIDTH:
+            raise ValueError("character 0x%02X: bounding box too wide" % code)
+        pixels = [[0] * (2 * MAX_WIDTH) for _ in range(height)]
+        top = ascent - (yoff + h)
+        bits = ((w + 7) // 8) * 8
+        for r, value in enumerate(rows[:h]):
+            j = top + r
+            if not 0 <= j < height:
+                continue
+            for i in range(w):
+                if (value >> (bits - 1 - i)) & 1:
+                    pixels[j][left + i] = 1
+        ink = [i for i in range(2 * MAX_WIDTH) if any(row[i] for row in pixels)]
+        if advance is None:
+            advance = ink[-1] + 1 if ink else 0
+        if ink:
+            advance = max(advance, ink[-1] + 1)
+        if advance > MAX_WIDTH:
+            raise ValueError("character 0x%02X: %d columns, %d max" % (code, advance, MAX_WIDTH))
+        advances[code] = advance
+        cells[code] = pixels
+    width = max(advances.values())
+    return width, height, dict((code, [row[:width] for row in pixels]) for code, pixels in cells.items()), advances
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a BDF font into an LCD_font header")
+    parser.add_argument("bdf", help="BDF font file")
+    parser.add_argument("--name", required=True, help="name of the font")
+    parser.add_argument("--output", help="header file, default name.h")
+    parser.add_argument("--first", type=lambda v: int(v, 0), default=0x20, help="first character")
+    parser.add_argument("--last", type=lambda v: int(v, 0), default=0xFF, help="last character")
+    arguments = parser.parse_args()
+
+    if not (0 <= arguments.first <= arguments.last <= 0xFF):
+        parser.error("range must be within 0x00..0xFF")
+    try:
+        ascent, descent, glyphs = read_bdf(arguments.bdf)
+        width, height, cells, advances = convert(ascent, descent, glyphs, arguments.first, arguments.last)
+    except ValueError as error:
+        print("%s: %s" % (os.path.basename(sys.argv[0]), error))
+        return 1
+    output = arguments.output or arguments.name + ".h"
+    total = write_header(output, arguments.name, width, height, cells, arguments.first, arguments.last,
+                         os.path.basename(arguments.bdf), advances, "BDF", "extras/Tools/bdf_convert.py")
+    print("%s: %d bytes" % (output, total))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
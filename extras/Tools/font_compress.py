@@ -0,0 +1,347 @@
+#!/usr/bin/env python3
+#
+# font_compress.py
+#
+# Generate the compressed Terminal fonts used by LCD_screen_font from the
+# original column-major MikroElektronika tables, see src/LCD_font.h for the format.
+#
+# Each glyph is trimmed to the bounding box of its lit pixels and stored as
+# a box header, 2 bytes up to 16 rows and 3 bytes above, followed by the box
+# bits, row-major, LSB first. The index gives the start of each glyph with a
+# byte, from a 16-bit base shared by a block of glyphs; blank glyphs take no
+# data. When the boxes do not pay for their headers and index, as for the
+# 6 x 8 font, the glyphs are stored as whole cells without index instead.
+#
+# The 16 x 24 font is derived from the 8 x 12 one with EPX (Scale2x), which
+# doubles the size while keeping diagonals smooth.
+#
+# Proportional fonts add an advance table: glyphs are moved to the left of
+# their cell and advance by their width plus one pixel.
+#
+# Usage, from the repository root:
+#   python3 extras/Tools/font_compress.py
+#       write src/Terminal6c.h, Terminal8c.h, Terminal12c.h and Terminal16c.h
+#   python3 extras/Tools/font_compress.py --check
+#       decode the headers in src and compare every glyph with the source
+#   python3 extras/Tools/font_compress.py --size 16 --first 0x30 --last 0x39 --name Digits16x24
+#       write Digits16x24.h, a subset font for a sketch, used with setFont(&Digits16x24)
+#   python3 extras/Tools/font_compress.py --size 8 --proportional --name Terminal8x12p --output src/Terminal8p.h
+#       write the proportional 8 x 12 font shipped in src
+#
+# https://github.com/Andy4495/Kentec_35_Parallel
+# This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+# See LICENSE file at above github repository
+#
+
+import argparse
+import os
+import re
+import sys
+
+FIRST = 0x20
+LAST = 0xFF
+ASCII_LAST = 0x7E
+SHORT = 16
+SRC = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "src")
+
+# size: (source, table, width, height, output, name)
+FONTS = {
+    6: ("Terminal6e.h", "Terminal6x8e", 6, 8, "Terminal6c.h", "Terminal6x8c"),
+    8: ("Terminal8e.h", "Terminal8x12e", 8, 12, "Terminal8c.h", "Terminal8x12c"),
+    12: ("Terminal12e.h", "Terminal12x16e", 12, 16, "Terminal12c.h", "Terminal12x16c"),
+    16: ("Terminal8e.h", "Terminal8x12e", 16, 24, "Terminal16c.h", "Terminal16x24c"),
+}
+
+
+def read_table(filename, name):
+    text = open(os.path.join(SRC, filename)).read()
+    start = text.index(name)
+    body = text[text.index("{", start):text.index("};", start)]
+    return [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]+", body)]
+
+
+def read_font(width, height, filename, name):
+    """Column-major table -> {code: rows of pixels}"""
+    data = read_table(filename, name)
+    bands = (height + 7) // 8
+    size = width * bands
+    glyphs = {}
+    for code in range(FIRST, LAST + 1):
+        columns = data[(code - FIRST) * size:(code - FIRST + 1) * size]
+        glyphs[code] = [[(columns[i * bands + (j >> 3)] >> (j & 7)) & 1
+                         for i in range(width)] for j in range(height)]
+    return glyphs
+
+
+def epx(pixels):
+    """Scale2x: each pixel becomes 2 x 2, corners follow matching neighbours"""
+    height, width = len(pixels), len(pixels[0])
+
+    def at(i, j):
+        return pixels[j][i] if (0 <= i < width and 0 <= j < height) else 0
+
+    result = [[0] * (2 * width) for _ in range(2 * height)]
+    for j in range(height):
+        for i in range(width):
+            p = at(i, j)
+            a, b, c, d = at(i, j - 1), at(i + 1, j), at(i - 1, j), at(i, j + 1)
+            e = [p, p, p, p]
+            if c == a and c != d and a != b:
+                e[0] = a
+            if a == b and a != c and b != d:
+                e[1] = b
+            if d == c and d != b and c != a:
+                e[2] = c
+            if b == d and b != a and d != c:
+                e[3] = d
+            result[2 * j][2 * i], result[2 * j][2 * i + 1] = e[0], e[1]
+            result[2 * j + 1][2 * i], result[2 * j + 1][2 * i + 1] = e[2], e[3]
+    return result
+
+
+def source_glyphs(size):
+    source, table, width, height = FONTS[size][:4]
+    if size == 16:
+        return dict((code, epx(pixels)) for code, pixels in read_font(8, 12, source, table).items())
+    return read_font(width, height, source, table)
+
+
+def proportional(glyphs, width):
+    """Move each glyph to the left of its cell -> glyphs, advances"""
+    advances = {}
+    for code, pixels in glyphs.items():
+        columns = [i for i in range(width) if any(row[i] for row in pixels)]
+        if not columns:
+            advances[code] = max(width // 2, 2)
+            continue
+        left, right = columns[0], columns[-1]
+        glyphs[code] = [row[left:] + [0] * left for row in pixels]
+        advances[code] = right - left + 2
+    return glyphs, advances
+
+
+def encode(pixels):
+    """Pixels -> glyph record, empty for a blank glyph"""
+    tall = len(pixels) > SHORT
+    lit = [(i, j) for j, row in enumerate(pixels) for i, bit in enumerate(row) if bit]
+    if not lit:
+        return []
+    left = min(i for i, _ in lit)
+    right = max(i for i, _ in lit)
+    top = min(j for _, j in lit)
+    bottom = max(j for _, j in lit)
+    w, h = right - left + 1, bottom - top + 1
+    bits = [pixels[j][i] for j in range(top, bottom + 1) for i in range(left, right + 1)]
+    record = [(left << 4) | (w - 1), top, h] if tall else [(left << 4) | (w - 1), (top << 4) | (h - 1)]
+    return record + pack(bits)
+
+
+def encode_cell(pixels):
+    """Pixels -> whole cell, row-major"""
+    return pack([bit for row in pixels for bit in row])
+
+
+def pack(bits):
+    return [sum(bit << k for k, bit in enumerate(bits[n:n + 8])) for n in range(0, len(bits), 8)]
+
+
+def decode(record, width, height):
+    pixels = [[0] * width for _ in range(height)]
+    if not record:
+        return pixels
+    if height > SHORT:
+        left, w, top, h, start = record[0] >> 4, (record[0] & 0x0F) + 1, record[1], record[2], 3
+    else:
+        left, w, top, h, start = record[0] >> 4, (record[0] & 0x0F) + 1, record[1] >> 4, (record[1] & 0x0F) + 1, 2
+    for n in range(w * h):
+        if (record[start + (n >> 3)] >> (n & 7)) & 1:
+            pixels[top + n // w][left + n % w] = 1
+    return pixels
+
+
+def decode_cell(record, width, height):
+    return [[(record[(j * width + i) >> 3] >> ((j * width + i) & 7)) & 1
+             for i in range(width)] for j in range(height)]
+
+
+def index(starts):
+    """Starts of the glyphs -> block, bases, offsets
+    The largest block of 1 << block glyphs whose offsets fit in a byte"""
+    for block in range(7, -1, -1):
+        bases = [starts[n] for n in range(0, len(starts), 1 << block)]
+        offsets = [start - bases[n >> block] for n, start in enumerate(starts)]
+        if max(offsets) < 256:
+            return block, bases, offsets
+    raise ValueError("glyph larger than 255 bytes")
+
+
+def write_header(output, name, width, height, glyphs, first, last, note, advances=None, kind="Terminal", tool="extras/Tools/font_compress.py"):
+    guard = re.sub(r"\W", "_", name).upper() + "_FONT_RELEASE"
+    if advances:
+        width = max(width, max(advances[code] for code in range(first, last + 1)))
+    split = first <= ASCII_LAST < last
+    ascii_glyphs = ASCII_LAST - first + 1
+    records = dict((code, encode(glyphs[code])) for code in range(first, last + 1))
+    starts, data = [], []
+    for code in range(first, last + 1):
+        starts.append(len(data))
+        data.extend(records[code])
+    starts.append(len(data))
+    block, bases, offsets = index(starts)
+
+    # Whole cells when the boxes do not pay, with the ASCII range for reference
+    cells = dict((code, encode_cell(glyphs[code])) for code in range(first, last + 1))
+    stride = len(cells[first])
+    boxed = len(data) + 2 * len(bases) + len(offsets)
+    if (last - first + 1) * stride <= boxed:
+        records, data, bases, offsets = cells, [], [], []
+        for code in range(first, last + 1):
+            data.extend(records[code])
+
+    def values(items):
+        return ["    " + ", ".join("%5d" % v for v in items[n:n + 12]) + ","
+                for n in range(0, len(items), 12)]
+
+    def array(ctype, suffix, items, split_at):
+        result = ["static const %s %s_%s[] =" % (ctype, name, suffix), "{"]
+        if split:
+            result += values(items[:split_at])
+            result.append("#if !defined(LCD_FONT_ASCII_ONLY)")
+            result += values(items[split_at:])
+            result.append("#endif")
+        else:
+            result += values(items)
+        return result + ["};", ""]
+
+    def descriptor(last):
+        if not bases:
+            lookup = "0, NULL, NULL"
+        else:
+            lookup = "%d, %s_bases, %s_offsets" % (block, name, name)
+        return "    %d, %d, 0x%02X, 0x%02X, %s, %s_data, %s" % (
+            width, height, first, last, lookup, name, (name + "_advances") if advances else "NULL")
+
+    lines = [
+        "///",
+        "/// @file       %s" % os.path.basename(output),
+        "/// @brief      Compressed font library",
+        "/// @details    Font %s %d x %d%s, characters 0x%02X to 0x%02X" % (
+            kind, width, height, ", proportional" if advances else "", first, last),
+        "/// @n          %s, see LCD_font.h" % ("Glyphs trimmed to their bounding box and bit-packed" if bases
+                                              else "Glyphs bit-packed in whole cells"),
+        "/// @n          Generated by %s from %s, do not edit" % (tool, note),
+        "///",
+    ]
+    if kind == "Terminal":
+        lines += [
+            "/// @copyright  (c) Rei VILO, 2012-2016 - SPECIAL EDITION FOR ENERGIA",
+            "/// @copyright  Attribution-NonCommercial-ShareAlike 3.0 Unported (CC BY-NC-SA 3.0)",
+            "///",
+            "/// @see        Font Generated by MikroElektronika GLCD Font Creator 1.2.0.0",
+            "/// @n          MikroeElektronika 2011 http://www.mikroe.com",
+            "///",
+        ]
+    lines += [
+        "",
+        "#ifndef %s" % guard,
+        "#define %s 100" % guard,
+        "",
+        '#include "LCD_font.h"',
+        "",
+    ]
+    if split:
+        lines += ["// With LCD_FONT_ASCII_ONLY, only characters 0x%02X to 0x%02X are linked" % (first, ASCII_LAST), ""]
+
+    if bases:
+        lines += array("uint16_t", "bases", bases, (ascii_glyphs >> block) + 1)
+        lines += array("uint8_t", "offsets", offsets, ascii_glyphs + 1)
+    if advances:
+        lines += array("uint8_t", "advances", [advances[code] for code in range(first, last + 1)], ascii_glyphs)
+
+    lines += ["static const uint8_t %s_data[] =" % name, "{"]
+    for code in range(first, last + 1):
+        if split and code == ASCII_LAST + 1:
+            lines.append("#if !defined(LCD_FONT_ASCII_ONLY)")
+        if records[code]:
+            lines.append("    " + ", ".join("0x%02X" % v for v in records[code]) + ",  // 0x%02X" % code)
+    if split:
+        lines.append("#endif")
+    lines += ["};", ""]
+
+    lines += ["static const LCD_font %s =" % name, "{"]
+    if split:
+        lines += ["#if defined(LCD_FONT_ASCII_ONLY)", descriptor(ASCII_LAST), "#else", descriptor(last), "#endif"]
+    else:
+        lines.append(descriptor(last))
+    lines += ["};", "", "#endif", ""]
+
+    open(output, "w").write("\n".join(lines))
+    return len(data) + 2 * len(bases) + len(offsets) + (last - first + 1 if advances else 0)
+
+
+def read_header(output, name, width, height):
+    text = re.sub(r"//.*", "", open(output).read())
+
+    def body(array):
+        start = text.index(array)
+        return text[text.index("{", start):text.index("};", start)]
+
+    data = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body(name + "_data"))]
+    if name + "_bases" not in text:
+        stride = (width * height + 7) // 8
+        return dict((FIRST + n, decode_cell(data[n * stride:(n + 1) * stride], width, height))
+                    for n in range(len(data) // stride))
+
+    # Block of the full font, the last descriptor
+    block = int(re.findall(r"0x[0-9A-F]+, 0x[0-9A-F]+, (\d+), " + name + "_bases", text)[-1])
+    bases = [int(v) for v in re.findall(r"\b\d+\b", body(name + "_bases"))]
+    offsets = [int(v) for v in re.findall(r"\b\d+\b", body(name + "_offsets"))]
+    starts = [bases[n >> block] + offset for n, offset in enumerate(offsets)]
+    return dict((FIRST + n, decode(data[starts[n]:starts[n + 1]], width, height))
+                for n in range(len(starts) - 1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate compressed LCD_screen_font fonts")
+    parser.add_argument("--check", action="store_true", help="verify the headers in src")
+    parser.add_argument("--size", type=int, choices=sorted(FONTS), help="font of a subset")
+    parser.add_argument("--first", type=lambda v: int(v, 0), default=FIRST, help="first character of a subset")
+    parser.add_argument("--last", type=lambda v: int(v, 0), default=LAST, help="last character of a subset")
+    parser.add_argument("--proportional", action="store_true", help="add an advance table")
+    parser.add_argument("--name", help="name of a subset font")
+    parser.add_argument("--output", help="header file of a subset font, default name.h")
+    arguments = parser.parse_args()
+
+    if arguments.size:
+        source, _, width, height, _, name = FONTS[arguments.size]
+        if not (FIRST <= arguments.first <= arguments.last <= LAST):
+            parser.error("range must be within 0x%02X..0x%02X" % (FIRST, LAST))
+        name = arguments.name or name
+        output = arguments.output or name + ".h"
+        glyphs, advances = source_glyphs(arguments.size), None
+        if arguments.proportional:
+            glyphs, advances = proportional(glyphs, width)
+        total = write_header(output, name, width, height, glyphs,
+                             arguments.first, arguments.last, source, advances)
+        print("%s: %d bytes" % (output, total))
+        return 0
+
+    status = 0
+    for size in sorted(FONTS):
+        source, _, width, height, output, name = FONTS[size]
+        glyphs = source_glyphs(size)
+        path = os.path.join(SRC, output)
+        if arguments.check:
+            decoded = read_header(path, name, width, height)
+            errors = sum(1 for code in glyphs if decoded.get(code) != glyphs[code])
+            print("%s: %s" % (output, "ok" if errors == 0 else "%d glyph(s) differ" % errors))
+            status |= errors != 0
+        else:
+            note = source if size != 16 else source + " with EPX scaling"
+            total = write_header(path, name, width, height, glyphs, FIRST, LAST, note)
+            print("%s: %d bytes" % (output, total))
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,163 @@
+//
+// life_benchmark.cpp
+//
+// Host benchmark of the LifeGame engine, in cells per second.
+//
+// Compares the bit-packed engine of examples/LCD_LifeGame/LifeBoard.cpp with
+// the former loop of the sketch: one byte per cell on two pages, with the state
+// in bit 3, eight bitRead() per cell and an age + 1 up to 7 in each byte.
+// Both start from the same random board and every generation is checked cell
+// by cell, state and age, before the two are timed separately, on the board
+// reached by then. The share of tiles the engine computed is shown as well.
+//
+// The host word is 32 bits; -DLIFE_HOST_16 forces the 16-bit words of the
+// MSP430 to compare the layouts.
+//
+// Usage, from the repository root:
+//   c++ -O2 -I examples/LCD_LifeGame -o life_benchmark extras/Tools/life_benchmark.cpp examples/LCD_LifeGame/LifeBoard.cpp
+//   ./life_benchmark [width height generations]
+//       default 80 60 2000
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "LifeBoard.h"
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+
+#define ALIVE 0x08
+#define DEAD  0x00
+
+static uint16_t width = 80;
+static uint16_t height = 60;
+static uint8_t *pages[2];
+static uint8_t page;
+
+static uint8_t &cell(uint8_t p, uint16_t x, uint16_t y)
+{
+    return pages[p][x * height + y];
+}
+
+// Former sketch, with the borders wrapped by index instead of unrolled
+static void referenceStep()
+{
+    for (uint16_t i = 0; i < width; i++) {
+        uint16_t il = (i > 0) ? i - 1 : width - 1;
+        uint16_t ir = (i + 1 < width) ? i + 1 : 0;
+        for (uint16_t j = 0; j < height; j++) {
+            uint16_t ju = (j > 0) ? j - 1 : height - 1;
+            uint16_t jd = (j + 1 < height) ? j + 1 : 0;
+            uint8_t neighbours;
+
+            neighbours  = bitRead(cell(page, il, ju), 3);
+            neighbours += bitRead(cell(page, i , ju), 3);
+            neighbours += bitRead(cell(page, ir, ju), 3);
+            neighbours += bitRead(cell(page, il, j ), 3);
+            neighbours += bitRead(cell(page, ir, j ), 3);
+            neighbours += bitRead(cell(page, il, jd), 3);
+            neighbours += bitRead(cell(page, i , jd), 3);
+            neighbours += bitRead(cell(page, ir, jd), 3);
+
+            uint8_t now = cell(page, i, j);
+            uint8_t &next = cell(page ^ 1, i, j);
+            if (bitRead(now, 3)) {
+                if ((neighbours < 2) || (neighbours > 3)) next = DEAD;
+                else next = (now + 1 > 0x0F) ? 0x0F : now + 1;
+            } else {
+                if (neighbours == 3) next = ALIVE;
+                else next = (now + 1 > 0x07) ? 0x07 : now + 1;
+            }
+        }
+    }
+    page ^= 1;
+}
+
+static double seconds()
+{
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t generations = 2000;
+
+    if (argc == 4) {
+        width = atoi(argv[1]);
+        height = atoi(argv[2]);
+        generations = atoi(argv[3]);
+    }
+    if ((width < 3) || (height < 3) || (width > 255 * LIFE_BITS)) {
+        fprintf(stderr, "width and height from 3, width up to %d\n", 255 * LIFE_BITS);
+        return 1;
+    }
+
+    pages[0] = new uint8_t[width * height];
+    pages[1] = new uint8_t[width * height];
+    lifeWord_t *buffer = new lifeWord_t[LIFE_BUFFER(width, height)];
+    LifeBoard board;
+    board.begin(buffer, width, height);
+
+    // Same board, 30% alive as in the sketch
+    srand(2013);
+    for (uint16_t x = 0; x < width; x++) {
+        for (uint16_t y = 0; y < height; y++) {
+            bool alive = (rand() % 100) > 70;
+            cell(page, x, y) = alive ? ALIVE : DEAD;
+            board.setCell(x, y, alive);
+        }
+    }
+
+    // Check
+    uint32_t errors = 0;
+    double active = 0;
+    for (uint32_t g = 0; (g < generations) && (errors == 0); g++) {
+        referenceStep();
+        board.clearChanges();
+        board.step();
+        active += board.activeTiles();
+        for (uint16_t x = 0; x < width; x++) {
+            for (uint16_t y = 0; y < height; y++) {
+                uint8_t expected = cell(page, x, y);
+                bool changed = (expected != cell(page ^ 1, x, y));
+                if ((board.getCell(x, y) != expected) || (board.isChanged(x, y) != changed)) {
+                    if (errors++ == 0) {
+                        printf("generation %u, cell %u,%u: %02x expected %02x\n",
+                               g + 1, x, y, board.getCell(x, y), expected);
+                    }
+                }
+            }
+        }
+    }
+    printf("%u x %u cells, %u-bit words, %u bytes against %u\n", width, height, LIFE_BITS,
+           (unsigned)(LIFE_BUFFER(width, height) * sizeof(lifeWord_t)), 2 * width * height);
+    printf("check: %s\n", (errors == 0) ? "identical" : "different");
+    if (errors > 0) return 1;
+    printf("tiles computed: %.1f%% on average, %.1f%% at the end\n",
+           100.0 * active / generations / LIFE_TILES(width, height),
+           100.0 * board.activeTiles() / LIFE_TILES(width, height));
+
+    // Timing
+    double cells = (double)width * height * generations;
+    double start = seconds();
+    for (uint32_t g = 0; g < generations; g++) referenceStep();
+    double reference = seconds() - start;
+
+    start = seconds();
+    for (uint32_t g = 0; g < generations; g++) board.step();
+    double packed = seconds() - start;
+
+    printf("byte per cell: %12.0f cells/s\n", cells / reference);
+    printf("bit-packed:    %12.0f cells/s\n", cells / packed);
+    printf("speedup:       %12.1f\n", reference / packed);
+
+    delete[] buffer;
+    delete[] pages[1];
+    delete[] pages[0];
+    return 0;
+}
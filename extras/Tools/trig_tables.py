@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+#
+# trig_tables.py
+#
+# Generate src/LCD_trig.h, the tables behind the fixed-point trigonometry of
+# LCD_utilities: sinQ15(), cosQ15() and atan2Angle().
+#
+# Angles are in binary units, 65536 for a full turn, so they wrap with uint16_t.
+# * Sine: a quarter wave of SINE_STEPS + 1 Q15 values, interpolated linearly.
+# * Arc tangent: ATAN_STEPS + 1 angles for ratios from 0 to 1, interpolated
+#   linearly; the other octants are derived by symmetry.
+#
+# Usage, from the repository root:
+#   python3 extras/Tools/trig_tables.py
+#       write src/LCD_trig.h
+#   python3 extras/Tools/trig_tables.py --check
+#       compare src/LCD_trig.h with the generated tables and show the interpolation error
+#
+# https://github.com/Andy4495/Kentec_35_Parallel
+# This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+# See LICENSE file at above github repository
+#
+
+import argparse
+import math
+import os
+import sys
+
+SINE_STEPS = 128
+ATAN_STEPS = 64
+QUARTER = 16384
+Q15 = 32768
+OUTPUT = os.path.join("src", "LCD_trig.h")
+
+
+def sine_table():
+    return [min(Q15 - 1, int(round(Q15 * math.sin(math.pi / 2 * k / SINE_STEPS)))) for k in range(SINE_STEPS + 1)]
+
+
+def atan_table():
+    return [int(round(QUARTER / (math.pi / 2) * math.atan(k / ATAN_STEPS))) for k in range(ATAN_STEPS + 1)]
+
+
+def sine(table, angle):
+    """Model of sinQ15() in LCD_utilities.cpp"""
+    angle &= 0xFFFF
+    negative = angle >= 2 * QUARTER
+    angle &= 2 * QUARTER - 1
+    if angle > QUARTER:
+        angle = 2 * QUARTER - angle
+    step = QUARTER // SINE_STEPS
+    index, fraction = angle // step, angle % step
+    value = table[index]
+    if fraction:
+        value += ((table[index + 1] - table[index]) * fraction + step // 2) // step
+    return -value if negative else value
+
+
+def arctangent(table, ratio):
+    """Model of the first octant of atan2Angle(), ratio in Q14 from 0 to 1"""
+    step = QUARTER // ATAN_STEPS
+    index, fraction = ratio // step, ratio % step
+    value = table[index]
+    if fraction:
+        value += ((table[index + 1] - table[index]) * fraction + step // 2) // step
+    return value
+
+
+def values(items, per_line=8):
+    return ["    " + ", ".join("%6d" % v for v in items[n:n + per_line]) + ","
+            for n in range(0, len(items), per_line)]
+
+
+def header():
+    lines = [
+        "///",
+        "/// @file       LCD_trig.h",
+        "/// @brief      Fixed-point trigonometry tables",
+        "/// @details    Quarter-wave sine in Q15, %d steps, and arc tangent in binary angle" % SINE_STEPS,
+        "/// @n          units, 65536 per turn, for ratios 0 to 1 in %d steps, see LCD_utilities.h" % ATAN_STEPS,
+        "/// @n          Generated by extras/Tools/trig_tables.py, do not edit",
+        "///",
+        "/// @n          https://github.com/Andy4495/Kentec_35_Parallel",
+        "/// @n          This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.",
+        "/// @n          See LICENSE file at above github repository",
+        "///",
+        "",
+        "#ifndef LCD_TRIG_RELEASE",
+        "#define LCD_TRIG_RELEASE 100",
+        "",
+        "#define LCD_SINE_STEPS %d" % SINE_STEPS,
+        "#define LCD_ATAN_STEPS %d" % ATAN_STEPS,
+        "",
+        "// sin(k * 90 / LCD_SINE_STEPS degrees) * 32768, 32767 max",
+        "static const int16_t _sineQ15[LCD_SINE_STEPS + 1] =",
+        "{",
+    ]
+    lines += values(sine_table())
+    lines += [
+        "};",
+        "",
+        "// atan(k / LCD_ATAN_STEPS) * 65536 / 2pi",
+        "static const uint16_t _atanAngle[LCD_ATAN_STEPS + 1] =",
+        "{",
+    ]
+    lines += values(atan_table())
+    lines += [
+        "};",
+        "",
+        "#endif",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def check():
+    try:
+        current = open(OUTPUT).read()
+    except OSError as error:
+        print("%s: %s" % (OUTPUT, error))
+        return 1
+    if current != header():
+        print("%s: differs from the generated tables" % OUTPUT)
+        return 1
+
+    table = sine_table()
+    error = max(abs(sine(table, angle) - Q15 * math.sin(2 * math.pi * angle / 65536)) for angle in range(65536))
+    print("sinQ15: max error %.2f LSB, %.6f" % (error, error / Q15))
+    table = atan_table()
+    error = max(abs(arctangent(table, ratio) - QUARTER / (math.pi / 2) * math.atan(ratio / QUARTER))
+                for ratio in range(QUARTER + 1))
+    print("atan2Angle: max error %.2f units, %.4f degrees" % (error, error * 360 / 65536))
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the fixed-point trigonometry tables")
+    parser.add_argument("--check", action="store_true", help="verify %s" % OUTPUT)
+    arguments = parser.parse_args()
+
+    if arguments.check:
+        return check()
+    with open(OUTPUT, "w") as output:
+        output.write(header())
+    print("%s: %d + %d entries" % (OUTPUT, SINE_STEPS + 1, ATAN_STEPS + 1))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,128 @@
+// LCD_cells.cpp
+//
+// Grid of coloured cells for LCD_screen based displays
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+// Library header
+#include "LCD_cells.h"
+
+// Pixels of unchanged cells bridged inside a run: cheaper than a new window
+#define CELLS_BRIDGE 16
+
+// Code
+LCD_cells::LCD_cells()
+{
+    _screen  = NULL;
+    _palette = NULL;
+    _x0 = _y0 = _columns = _rows = 0;
+    _dx = _dy = 1;
+    _bridge  = 0;
+    _indexes = NULL;
+    _colours = NULL;
+}
+
+void LCD_cells::begin(LCD_screen *screen, uint16_t x0, uint16_t y0, uint16_t columns, uint16_t rows, uint8_t dx, uint8_t dy)
+{
+    _screen  = screen;
+    _x0 = x0;
+    _y0 = y0;
+    _columns = columns;
+    _rows    = rows;
+    _dx = max(dx, 1);
+    _dy = max(dy, 1);
+    _bridge  = CELLS_BRIDGE / ((uint16_t)_dx * _dy);
+}
+
+void LCD_cells::setPalette(const uint16_t *palette)
+{
+    _palette = palette;
+}
+
+uint16_t LCD_cells::drawRow(uint16_t row, const uint8_t *indexes, const uint8_t *changed)
+{
+    if (_palette == NULL) return 0;
+
+    _indexes = indexes;
+    _colours = NULL;
+    return _drawRow(row, changed);
+}
+
+uint16_t LCD_cells::drawRow(uint16_t row, const uint16_t *colours, const uint8_t *changed)
+{
+    _indexes = NULL;
+    _colours = colours;
+    return _drawRow(row, changed);
+}
+
+uint16_t LCD_cells::columns()
+{
+    return _columns;
+}
+
+uint16_t LCD_cells::rows()
+{
+    return _rows;
+}
+
+uint16_t LCD_cells::_colour(uint16_t column)
+{
+    return (_indexes != NULL) ? _palette[_indexes[column]] : _colours[column];
+}
+
+uint16_t LCD_cells::_drawRow(uint16_t row, const uint8_t *changed)
+{
+    if ((_screen == NULL) || (row >= _rows)) return 0;
+
+    if (changed == NULL) {
+        _drawRun(row, 0, _columns);
+        return 1;
+    }
+
+    uint16_t windows = 0;
+    uint16_t column = 0;
+
+    while (column < _columns) {
+        // Eight unchanged cells at once
+        if (((column & 0x07) == 0) && (changed[column >> 3] == 0)) {
+            column += 8;
+            continue;
+        }
+        if (((changed[column >> 3] >> (column & 0x07)) & 0x01) == 0) {
+            column++;
+            continue;
+        }
+
+        // Changed cells, with short gaps of unchanged ones
+        uint16_t end = column + 1;
+        for (uint16_t n = column + 1; n < _columns; n++) {
+            if ((changed[n >> 3] >> (n & 0x07)) & 0x01) end = n + 1;
+            else if (n - end >= _bridge) break;
+        }
+        _drawRun(row, column, end - column);
+        windows++;
+        column = end;
+    }
+    return windows;
+}
+
+// One window for the run, cells of the same colour in one burst per pixel row
+void LCD_cells::_drawRun(uint16_t row, uint16_t column, uint16_t length)
+{
+    uint16_t x = _x0 + column * _dx;
+    uint16_t y = _y0 + row * _dy;
+
+    _screen->setWindow(x, y, x + length * _dx - 1, y + _dy - 1);
+    for (uint8_t j = 0; j < _dy; j++) {
+        uint16_t n = column;
+        while (n < column + length) {
+            uint16_t colour = _colour(n);
+            uint16_t start = n;
+            while ((++n < column + length) && (_colour(n) == colour));
+            _screen->writeColour(colour, (uint32_t)(n - start) * _dx);
+        }
+    }
+}
@@ -0,0 +1,97 @@
+// LCD_cells.h
+//
+// Grid of coloured cells for LCD_screen based displays
+//
+// The sketch keeps the cells, as a cellular automaton or a heat map does, and
+// hands the renderer one row at a time: the colour of each cell, as RGB565 or
+// as an index into a palette, and a mask of the cells that changed. The changed
+// cells next to each other are merged into runs, each one sent in a single
+// window: row of pixels after row of pixels, with neighbouring cells of the
+// same colour sent as one burst. A few unchanged cells between two changed
+// ones are sent again inside the run when that costs less than a new window.
+//
+// The mask has one bit per cell, lowest bit first: the bytes of little-endian
+// words, as uint16_t or uint32_t bit planes, can be given as they are.
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include "Energia.h"
+
+#ifndef LCD_CELLS_RELEASE
+///
+/// @brief	Library release number
+///
+#define LCD_CELLS_RELEASE 100
+
+#include "LCD_screen.h"
+
+///
+/// @brief      Grid of cells redrawn in runs of changed cells
+///
+class LCD_cells {
+public:
+
+    ///
+    /// @brief	Constructor
+    ///
+    LCD_cells();
+
+    ///
+    /// @brief	Attach the grid to a screen
+    /// @param	screen pointer to the screen
+    /// @param	x0 left
+    /// @param	y0 top
+    /// @param	columns number of cells per row
+    /// @param	rows number of rows
+    /// @param	dx width of a cell, pixels
+    /// @param	dy height of a cell, pixels
+    ///
+    void begin(LCD_screen *screen, uint16_t x0, uint16_t y0, uint16_t columns, uint16_t rows, uint8_t dx, uint8_t dy);
+
+    ///
+    /// @brief	Palette for the rows given as indexes
+    /// @param	palette RGB565 colours, kept by the caller
+    ///
+    void setPalette(const uint16_t *palette);
+
+    ///
+    /// @brief	Draw the changed cells of a row, given as palette indexes
+    /// @param	row row of the grid
+    /// @param	indexes one palette index per cell
+    /// @param	changed one bit per cell, lowest bit first, NULL for the whole row
+    /// @return	number of windows sent
+    ///
+    uint16_t drawRow(uint16_t row, const uint8_t *indexes, const uint8_t *changed = NULL);
+
+    ///
+    /// @brief	Draw the changed cells of a row, given as colours
+    /// @param	row row of the grid
+    /// @param	colours one RGB565 colour per cell
+    /// @param	changed one bit per cell, lowest bit first, NULL for the whole row
+    /// @return	number of windows sent
+    ///
+    uint16_t drawRow(uint16_t row, const uint16_t *colours, const uint8_t *changed = NULL);
+
+    uint16_t columns();
+    uint16_t rows();
+
+private:
+    LCD_screen *_screen;
+    const uint16_t *_palette;
+    uint16_t _x0, _y0, _columns, _rows;
+    uint8_t _dx, _dy;
+    uint8_t _bridge;
+
+    // Row being drawn, by indexes or by colours
+    const uint8_t *_indexes;
+    const uint16_t *_colours;
+
+    uint16_t _colour(uint16_t column);
+    uint16_t _drawRow(uint16_t row, const uint8_t *changed);
+    void _drawRun(uint16_t row, uint16_t column, uint16_t length);
+};
+
+#endif
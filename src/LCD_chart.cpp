@@ -0,0 +1,188 @@
+// LCD_chart.cpp
+//
+// Strip chart for LCD_screen based displays
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+// Library header
+#include "LCD_chart.h"
+
+// Code
+LCD_chart::LCD_chart()
+{
+    _screen  = NULL;
+    _columns = NULL;
+    _x0 = _y0 = _dx = _dy = 0;
+    _low  = 0;
+    _high = 1;
+    _scale = 0;
+    _traceColour  = whiteColour;
+    _backColour   = blackColour;
+    _cursorColour = grayColour;
+    _scrolling = false;
+    _samples = 1;
+    _count   = 0;
+    _top = _bottom = _last = 0;
+    _first = true;
+    _added = _shown = 0;
+    _head = _tail = 0;
+}
+
+void LCD_chart::begin(LCD_screen *screen, LCD_chartColumn *columns, uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    _screen  = screen;
+    _columns = columns;
+    _x0 = x0;
+    _y0 = y0;
+    _dx = dx;
+    _dy = min(dy, 256);
+    setRange(_low, _high);
+
+    _count = 0;
+    _first = true;
+    _added = _shown = 0;
+    _head = _tail = 0;
+    // Empty columns, top below bottom
+    for (uint16_t x = 0; x < _dx; x++) {
+        _columns[x].top    = 0xFF;
+        _columns[x].bottom = 0;
+    }
+
+    // The gate scan start scrolls the whole screen, so only a chart covering it
+    // scrolls; the offset a previous chart may have left is reset in any case
+    _scrolling = _screen->setScroll(0, false) && (_x0 == 0) && (_y0 == 0) &&
+                 (_dx == _screen->screenSizeX()) && (_dy == _screen->screenSizeY());
+    redraw();
+}
+
+void LCD_chart::end()
+{
+    if (_scrolling) _screen->setScroll(0, false);
+    _scrolling = false;
+    _columns = NULL;
+}
+
+void LCD_chart::setRange(int16_t low, int16_t high)
+{
+    if (high == low) high = low + 1;
+    if (high < low) {
+        int16_t w = low;
+        low = high;
+        high = w;
+    }
+    _low  = low;
+    _high = high;
+    // Value to row without division, rounded down so the top value stays in the chart
+    _scale = ((uint32_t)(_dy - 1) << 16) / (uint16_t)(_high - _low);
+}
+
+void LCD_chart::setDecimation(uint16_t samples)
+{
+    _samples = max(samples, 1);
+}
+
+void LCD_chart::setColours(uint16_t traceColour, uint16_t backColour, uint16_t cursorColour)
+{
+    _traceColour  = traceColour;
+    _backColour   = backColour;
+    _cursorColour = cursorColour;
+}
+
+void LCD_chart::add(int16_t value)
+{
+    if (_columns == NULL) return;
+
+    uint8_t row = _row(value);
+
+    if (_count == 0) {
+        // The column starts from the last sample of the previous one
+        if (_first) _last = row;
+        _top = _bottom = _last;
+        _first = false;
+    }
+    if (row < _top) _top = row;
+    if (row > _bottom) _bottom = row;
+    _last = row;
+
+    if (++_count >= _samples) {
+        _columns[_head].top    = _top;
+        _columns[_head].bottom = _bottom;
+        _head = (_head + 1 < _dx) ? _head + 1 : 0;
+        _added++;
+        _count = 0;
+    }
+}
+
+uint16_t LCD_chart::update()
+{
+    if (_columns == NULL) return 0;
+
+    uint16_t added = _added;
+    uint16_t count = added - _shown;
+
+    // Only the last dx columns are still in the ring
+    if (count > _dx) {
+        _tail = _head;
+        count = _dx;
+    }
+    _shown = added;
+    for (uint16_t n = 0; n < count; n++) {
+        _drawColumn(_x0 + _tail, _columns[_tail].top, _columns[_tail].bottom, _traceColour);
+        _tail = (_tail + 1 < _dx) ? _tail + 1 : 0;
+    }
+    if (count > 0) _showNext();
+    return count;
+}
+
+void LCD_chart::redraw()
+{
+    if (_columns == NULL) return;
+
+    _shown = _added;
+    _tail = _head;
+    for (uint16_t index = 0; index < _dx; index++) {
+        _drawColumn(_x0 + index, _columns[index].top, _columns[index].bottom, _traceColour);
+    }
+    _showNext();
+}
+
+bool LCD_chart::isScrolling()
+{
+    return _scrolling;
+}
+
+// The next column to be drawn is the oldest one
+void LCD_chart::_showNext()
+{
+    if (_scrolling) {
+        // Gate scan start on it, so the newest column is on the right
+        _screen->setScroll(_tail, false);
+    } else {
+        // Sweep cursor
+        _drawColumn(_x0 + _tail, 0, _dy - 1, _cursorColour);
+    }
+}
+
+// Row from the top of the chart, with the value clamped to the range
+uint8_t LCD_chart::_row(int16_t value)
+{
+    if (value <= _low) return _dy - 1;
+    if (value >= _high) return 0;
+    return _dy - 1 - (uint8_t)(((uint32_t)(uint16_t)(value - _low) * _scale) >> 16);
+}
+
+// One column, one window: background, span, background
+void LCD_chart::_drawColumn(uint16_t x, uint8_t top, uint8_t bottom, uint16_t colour)
+{
+    _screen->setWindow(x, _y0, x, _y0 + _dy - 1);
+    if (top > bottom) {
+        _screen->writeColour(_backColour, _dy);
+        return;
+    }
+    if (top > 0) _screen->writeColour(_backColour, top);
+    _screen->writeColour(colour, bottom - top + 1);
+    if (bottom < _dy - 1) _screen->writeColour(_backColour, _dy - 1 - bottom);
+}
@@ -0,0 +1,139 @@
+// LCD_chart.h
+//
+// Strip chart for LCD_screen based displays
+//
+// Samples are decimated into columns: each column keeps the lowest and the
+// highest sample of its bucket, extended to the last sample of the previous
+// column so the trace stays continuous. Adding a sample costs a multiply and
+// two comparisons; it can be called from an interrupt.
+//
+// A completed column is drawn by update() as a single vertical span: one
+// window of one pixel wide, filled with three runs, background, trace and
+// background, so drawing costs O(height) per column and the chart is never
+// drawn again as a whole.
+//
+// The columns form a ring, kept in a buffer statically allocated by the caller.
+// * Hardware scroll: when the chart covers the whole screen and the
+//   orientation allows a horizontal scroll, as orientations 0 and 2 on the
+//   SSD2119, each column keeps its GRAM position and the gate scan start
+//   moves, so the newest column is always on the right. The scroll moves the
+//   whole screen, so a chart with anything beside it sweeps instead; end()
+//   puts the screen back when the chart is no longer used.
+// * Sweep: otherwise the new column is drawn at its ring position, followed
+//   by a cursor column, as on an oscilloscope.
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include "Energia.h"
+
+#ifndef LCD_CHART_RELEASE
+///
+/// @brief	Library release number
+///
+#define LCD_CHART_RELEASE 100
+
+#include "LCD_screen.h"
+
+///
+/// @brief      Column of the chart, rows of the trace from the top of the chart
+///
+struct LCD_chartColumn {
+    uint8_t top, bottom;
+};
+
+///
+/// @brief      Strip chart with min/max decimation
+///
+class LCD_chart {
+public:
+
+    ///
+    /// @brief	Constructor
+    ///
+    LCD_chart();
+
+    ///
+    /// @brief	Attach the chart to a screen
+    /// @param	screen pointer to the screen
+    /// @param	columns dx columns, statically allocated by the caller
+    /// @param	x0 left
+    /// @param	y0 top
+    /// @param	dx width, pixels, one column each
+    /// @param	dy height, pixels, 256 max
+    /// @note   The chart area is cleared, and the hardware scroll reset.
+    ///
+    void begin(LCD_screen *screen, LCD_chartColumn *columns, uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+    ///
+    /// @brief	Detach the chart, the hardware scroll reset when used
+    ///
+    void end();
+
+    ///
+    /// @brief	Values at the bottom and at the top of the chart
+    ///
+    void setRange(int16_t low, int16_t high);
+
+    ///
+    /// @brief	Number of samples per column
+    ///
+    void setDecimation(uint16_t samples);
+
+    ///
+    /// @brief	Set the colours
+    /// @param	traceColour trace
+    /// @param	backColour background
+    /// @param	cursorColour sweep cursor
+    ///
+    void setColours(uint16_t traceColour, uint16_t backColour = blackColour, uint16_t cursorColour = grayColour);
+
+    ///
+    /// @brief	Add a sample
+    /// @note   O(1), safe from an interrupt; the screen is only drawn by update().
+    ///
+    void add(int16_t value);
+
+    ///
+    /// @brief	Draw the columns completed since the last update
+    /// @return	number of columns drawn
+    ///
+    uint16_t update();
+
+    ///
+    /// @brief	Draw the whole chart again from the ring of columns
+    ///
+    void redraw();
+
+    ///
+    /// @brief	Whether the chart uses the hardware scroll
+    ///
+    bool isScrolling();
+
+private:
+    LCD_screen *_screen;
+    LCD_chartColumn *_columns;
+    uint16_t _x0, _y0, _dx, _dy;
+    int16_t _low, _high;
+    uint32_t _scale;
+    uint16_t _traceColour, _backColour, _cursorColour;
+    bool _scrolling;
+
+    // Bucket of the column being filled
+    uint16_t _samples, _count;
+    uint8_t _top, _bottom, _last;
+    bool _first;
+
+    // Columns completed by add(), free-running, and next ring position
+    volatile uint16_t _added, _head;
+    // Columns drawn by update(), free-running, and next ring position
+    uint16_t _shown, _tail;
+
+    uint8_t _row(int16_t value);
+    void _showNext();
+    void _drawColumn(uint16_t x, uint8_t top, uint8_t bottom, uint16_t colour);
+};
+
+#endif
@@ -0,0 +1,206 @@
+// LCD_colour.cpp
+//
+// Batch RGB565 colour kernels
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+// Library header
+#include "LCD_colour.h"
+#include "LCD_utilities.h"
+
+// Per-channel LSB cleared: the halves of two colours add without carrying across channels
+#define HALF_MASK_16   0xF7DE
+#define HALF_MASK_32   0xF7DEF7DE
+// Green moved to the upper half-word: each channel gets at least 5 spare bits above it
+#define SPREAD_MASK    0x07E0F81F
+
+// Code
+static inline LCD_colourWord _average(LCD_colourWord a, LCD_colourWord b)
+{
+#if defined(__MSP430__)
+    return (a & b) + (((a ^ b) & HALF_MASK_16) >> 1);
+#else
+    return (a & b) + (((a ^ b) & HALF_MASK_32) >> 1);
+#endif
+}
+
+// alpha5: 0 = colour2 .. 32 = colour1
+static inline uint16_t _blend(uint16_t colour1, uint16_t colour2, uint8_t alpha5)
+{
+#if defined(__MSP430__)
+    // a * alpha + b * (1 - alpha) as a chain of 50% blends, LSB of alpha first
+    if (alpha5 >= 32) return colour1;
+    uint16_t result = colour2;
+    for (uint8_t i = 0; i < 5; i++) {
+        result = _average(result, (alpha5 & 0x01) ? colour1 : colour2);
+        alpha5 >>= 1;
+    }
+    return result;
+#else
+    uint32_t a = (colour1 | ((uint32_t)colour1 << 16)) & SPREAD_MASK;
+    uint32_t b = (colour2 | ((uint32_t)colour2 << 16)) & SPREAD_MASK;
+    b = (b + (((a - b) * alpha5) >> 5)) & SPREAD_MASK;
+    return (uint16_t)(b | (b >> 16));
+#endif
+}
+
+// 0..255 -> 0..32, rounded and monotonic: 252 and above give 32
+static inline uint8_t _alpha5(uint8_t alpha)
+{
+    return (alpha + 4) >> 3;
+}
+
+uint16_t blendColour(uint16_t colour1, uint16_t colour2)
+{
+    return (colour1 & colour2) + (((colour1 ^ colour2) & HALF_MASK_16) >> 1);
+}
+
+uint16_t blendColour(uint16_t colour1, uint16_t colour2, uint8_t alpha)
+{
+    return _blend(colour1, colour2, _alpha5(alpha));
+}
+
+void blendColours(uint16_t *destination, const uint16_t *source1, const uint16_t *source2, uint16_t count)
+{
+#if !defined(__MSP430__)
+    // Two pixels per word when the three buffers share the same alignment
+    if (((((uintptr_t)destination) ^ ((uintptr_t)source1)) & 0x03) == 0 &&
+        ((((uintptr_t)destination) ^ ((uintptr_t)source2)) & 0x03) == 0) {
+        if ((count > 0) && (((uintptr_t)destination) & 0x03)) {
+            *destination++ = blendColour(*source1++, *source2++);
+            count--;
+        }
+        uint32_t *d = (uint32_t *)destination;
+        const uint32_t *s1 = (const uint32_t *)source1;
+        const uint32_t *s2 = (const uint32_t *)source2;
+        for (; count > 1; count -= 2) *d++ = _average(*s1++, *s2++);
+        destination = (uint16_t *)d;
+        source1 = (const uint16_t *)s1;
+        source2 = (const uint16_t *)s2;
+    }
+#endif
+    for (; count > 0; count--) *destination++ = blendColour(*source1++, *source2++);
+}
+
+void blendColours(uint16_t *destination, const uint16_t *source1, const uint16_t *source2, uint16_t count, uint8_t alpha)
+{
+    uint8_t alpha5 = _alpha5(alpha);
+    for (; count > 0; count--) *destination++ = _blend(*source1++, *source2++, alpha5);
+}
+
+void blendColours(uint16_t *destination, const uint16_t *source, uint16_t colour, uint16_t count, uint8_t alpha)
+{
+    uint8_t alpha5 = _alpha5(alpha);
+#if defined(__MSP430__)
+    for (; count > 0; count--) *destination++ = _blend(*source++, colour, alpha5);
+#else
+    // Constant part computed once: b * (32 - alpha)
+    uint32_t b = (colour | ((uint32_t)colour << 16)) & SPREAD_MASK;
+    b = (b * (32 - alpha5)) >> 5;
+    for (; count > 0; count--) {
+        uint32_t a = (*source | ((uint32_t)*source << 16)) & SPREAD_MASK;
+        a = (((a * alpha5) >> 5) + b) & SPREAD_MASK;
+        *destination++ = (uint16_t)(a | (a >> 16));
+        source++;
+    }
+#endif
+}
+
+void scaleColours(uint16_t *destination, const uint16_t *source, uint16_t count, uint8_t brightness)
+{
+    uint8_t alpha5 = _alpha5(brightness);
+#if defined(__MSP430__)
+    for (; count > 0; count--) *destination++ = _blend(*source++, 0x0000, alpha5);
+#else
+    for (; count > 0; count--) {
+        uint32_t a = (*source | ((uint32_t)*source << 16)) & SPREAD_MASK;
+        a = ((a * alpha5) >> 5) & SPREAD_MASK;
+        *destination++ = (uint16_t)(a | (a >> 16));
+        source++;
+    }
+#endif
+}
+
+// Channel stepped over a span with a Bresenham error term: each pixel gets the
+// rounded value, and the last one the end value exactly
+struct _Channel {
+    uint8_t  value;
+    int8_t   step, carry;
+    uint16_t remainder, error;
+};
+
+static void _channelBegin(_Channel &channel, uint8_t start, uint8_t end, uint16_t steps)
+{
+    int8_t delta = end - start;
+    uint8_t size = (delta < 0) ? -delta : delta;
+
+    channel.value     = start;
+    channel.carry     = (delta < 0) ? -1 : 1;
+    channel.step      = (size / steps) * channel.carry;
+    channel.remainder = size % steps;
+    channel.error     = steps / 2;
+}
+
+static inline void _channelNext(_Channel &channel, uint16_t steps)
+{
+    channel.value += channel.step;
+    // error + remainder >= steps, written so it cannot overflow
+    if (channel.error >= steps - channel.remainder) {
+        channel.error -= steps - channel.remainder;
+        channel.value += channel.carry;
+    } else {
+        channel.error += channel.remainder;
+    }
+}
+
+void gradientLinear(uint16_t *span, uint16_t count, uint16_t colour1, uint16_t colour2)
+{
+    if (count == 0) return;
+    if (count == 1) {
+        *span = colour1;
+        return;
+    }
+
+    uint16_t steps = count - 1;
+    _Channel r, g, b;
+    _channelBegin(r, colour1 >> 11, colour2 >> 11, steps);
+    _channelBegin(g, (colour1 >> 5) & 0x3F, (colour2 >> 5) & 0x3F, steps);
+    _channelBegin(b, colour1 & 0x1F, colour2 & 0x1F, steps);
+
+    for (; count > 1; count--) {
+        *span++ = ((uint16_t)r.value << 11) | ((uint16_t)g.value << 5) | b.value;
+        _channelNext(r, steps);
+        _channelNext(g, steps);
+        _channelNext(b, steps);
+    }
+    *span = colour2;
+}
+
+void gradientRadial(uint16_t *span, uint16_t count, int16_t dx, int16_t dy, uint16_t radius, uint16_t colour1, uint16_t colour2)
+{
+    if (radius == 0) radius = 1;
+
+    // Distance tracked incrementally: it changes by at most 1 per pixel
+    uint32_t distance2 = (int32_t)dx * dx + (int32_t)dy * dy;
+    uint16_t distance  = isqrt32(distance2);
+    uint32_t scale     = ((uint32_t)32 << 16) / radius;
+    uint8_t  alpha5    = 0;
+    uint16_t last      = 0xFFFF;
+
+    for (; count > 0; count--) {
+        if (distance != last) {
+            last   = distance;
+            alpha5 = (distance >= radius) ? 32 : (uint8_t)(((uint32_t)distance * scale) >> 16);
+        }
+        *span++ = _blend(colour2, colour1, alpha5);
+
+        // (dx+1)^2 = dx^2 + 2dx + 1
+        distance2 += 2 * (int32_t)dx + 1;
+        dx++;
+        while ((uint32_t)(distance + 1) * (distance + 1) <= distance2) distance++;
+        while ((uint32_t)distance * distance > distance2) distance--;
+    }
+}
@@ -0,0 +1,86 @@
+// LCD_colour.h
+//
+// Batch RGB565 colour kernels
+//
+// The kernels work on packed RGB565 words with SWAR (SIMD within a register)
+// masking, so the three channels are processed with a handful of integer
+// operations instead of being split and recombined one by one.
+// * MSP432 and Tiva: 32-bit words, two pixels per word for 50% blends.
+// * MSP430: 16-bit words, alpha blends as a chain of 50% blends, no multiply.
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include "Energia.h"
+
+#ifndef LCD_COLOUR_RELEASE
+///
+/// @brief	Library release number
+///
+#define LCD_COLOUR_RELEASE 100
+
+///
+/// @brief	Native word for the kernels
+///
+#if defined(__MSP430__)
+typedef uint16_t LCD_colourWord;
+#else
+typedef uint32_t LCD_colourWord;
+#endif
+
+///
+/// @brief	50% blend of two colours, per channel, rounded down
+///
+uint16_t blendColour(uint16_t colour1, uint16_t colour2);
+
+///
+/// @brief	Alpha blend of two colours
+/// @param	alpha 0 = colour2 only .. 255 = colour1 only, 5-bit precision
+///
+uint16_t blendColour(uint16_t colour1, uint16_t colour2, uint8_t alpha);
+
+///
+/// @brief	50% blend of two buffers
+/// @param	destination count colours, may be one of the sources
+///
+void blendColours(uint16_t *destination, const uint16_t *source1, const uint16_t *source2, uint16_t count);
+
+///
+/// @brief	Alpha blend of two buffers
+/// @param	alpha 0 = source2 only .. 255 = source1 only
+///
+void blendColours(uint16_t *destination, const uint16_t *source1, const uint16_t *source2, uint16_t count, uint8_t alpha);
+
+///
+/// @brief	Alpha blend of a buffer against a constant colour
+/// @param	alpha 0 = colour only .. 255 = source only
+///
+void blendColours(uint16_t *destination, const uint16_t *source, uint16_t colour, uint16_t count, uint8_t alpha);
+
+///
+/// @brief	Brightness scaling
+/// @param	brightness 0 = black .. 255 = unchanged
+///
+void scaleColours(uint16_t *destination, const uint16_t *source, uint16_t count, uint8_t brightness);
+
+///
+/// @brief	Linear gradient into a span buffer
+/// @param	span count colours, from colour1 to colour2 included
+///
+void gradientLinear(uint16_t *span, uint16_t count, uint16_t colour1, uint16_t colour2);
+
+///
+/// @brief	Radial gradient into a span buffer
+/// @details One horizontal span, starting at (dx, dy) relative to the centre.
+/// @param	span count colours
+/// @param	dx horizontal offset of the first pixel from the centre
+/// @param	dy vertical offset of the span from the centre
+/// @param	radius distance at which colour2 is reached
+/// @param	colour1 colour at the centre
+/// @param	colour2 colour at radius and beyond
+///
+void gradientRadial(uint16_t *span, uint16_t count, int16_t dx, int16_t dy, uint16_t radius, uint16_t colour1, uint16_t colour2);
+
+#endif
@@ -0,0 +1,345 @@
+// LCD_console.cpp
+//
+// Scrolling text console for LCD_screen_font based displays
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+// Library header
+#include "LCD_console.h"
+
+#define CONSOLE_DIRTY       0x8000
+#define CONSOLE_BRIGHT      0x40
+#define CONSOLE_DEFAULT     (CONSOLE_BRIGHT | 0x07)     // bright white on black
+#define CONSOLE_ESCAPE      0x1B
+// Clean cells bridged inside a dirty run: cheaper than a new window
+#define CONSOLE_GAP         1
+// Characters sent per text window
+#define CONSOLE_RUN         32
+
+// ANSI colours: black, red, green, yellow, blue, magenta, cyan, white, then bright
+static const uint16_t _palette[16] = {
+    0x0000, 0xA800, 0x0540, 0xAD40, 0x0015, 0xA815, 0x0555, 0xAD55,
+    0x52AA, 0xFAAA, 0x57EA, 0xFFEA, 0x52BF, 0xFABF, 0x57FF, 0xFFFF
+};
+
+// Code
+LCD_console::LCD_console()
+{
+    _screen  = NULL;
+    _font    = NULL;
+    _cells   = NULL;
+    _columns = _rows = 0;
+    _column  = _row = _top = 0;
+    _attribute  = CONSOLE_DEFAULT;
+    _scrollMode = SCROLL_REDRAW;
+    _escape  = 0;
+    _count   = 0;
+    _utf8Count = 0;
+}
+
+void LCD_console::begin(LCD_screen_font *screen, LCD_consoleCell *cells, uint8_t columns, uint8_t rows)
+{
+    _screen  = screen;
+    _font    = screen->getFont();
+    _cells   = cells;
+    _columns = columns;
+    _rows    = rows;
+    _column  = _row = _top = 0;
+    _attribute = CONSOLE_DEFAULT;
+    _escape  = 0;
+
+    // All cells dirty, so the console area is drawn once
+    for (uint16_t n = 0; n < (uint16_t)_columns * _rows; n++) {
+        _cells[n] = ' ' | (CONSOLE_DEFAULT << 8) | CONSOLE_DIRTY;
+    }
+
+    // The gate scan start scrolls the whole screen, so only a console covering it scrolls
+    if (_screen->setScroll(0, true) &&
+        ((uint16_t)_columns * _font->width == _screen->screenSizeX()) &&
+        ((uint16_t)_rows * _font->height == _screen->screenSizeY())) {
+        _scrollMode = SCROLL_HARDWARE;
+    } else if (_screen->isReadable()) {
+        _scrollMode = SCROLL_COPY;
+    } else {
+        _scrollMode = SCROLL_REDRAW;
+    }
+    update();
+}
+
+void LCD_console::clear()
+{
+    for (uint8_t row = 0; row < _rows; row++) _clear(row, 0, _columns - 1);
+    _column = _row = 0;
+    update();
+}
+
+void LCD_console::setCursor(uint8_t column, uint8_t row)
+{
+    _column = min(column, _columns - 1);
+    _row    = min(row, _rows - 1);
+}
+
+size_t LCD_console::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+size_t LCD_console::write(const uint8_t *buffer, size_t size)
+{
+    if (_screen == NULL) return 0;
+
+    for (size_t k = 0; k < size; k++) {
+        uint8_t c = buffer[k];
+
+        // UTF-8 sequence, possibly split between writes: a byte that breaks it
+        // leaves the received bytes to stand for themselves
+        if (_utf8Count > 0) {
+            if ((c & 0xC0) == 0x80) {
+                _utf8[_utf8Count++] = c;
+                if (_utf8Count == utf8Length(_utf8[0])) _putUTF8();
+                continue;
+            }
+            _putUTF8();
+        }
+
+        if (_escape > 0) {
+            _escapeChar(c);
+        } else if (c == CONSOLE_ESCAPE) {
+            _escape = 1;
+        } else if (c == '\n') {
+            _column = 0;
+            _lineFeed();
+        } else if (c == '\r') {
+            _column = 0;
+        } else if (c == '\b') {
+            if (_column > 0) _column--;
+        } else if (c == '\t') {
+            do _putChar(' '); while ((_column & 0x07) && (_column < _columns));
+        } else if (utf8Length(c) > 1) {
+            _utf8[0] = c;
+            _utf8Count = 1;
+        } else if (c >= ' ') {
+            _putChar(c);
+        }
+    }
+    update();
+    return size;
+}
+
+// Cells of a row of the console, the rows form a ring starting at _top
+LCD_consoleCell *LCD_console::_line(uint8_t row)
+{
+    return _cells + (uint16_t)((_top + row) % _rows) * _columns;
+}
+
+// Change a cell, marked dirty only if the character or the colours differ
+void LCD_console::_set(LCD_consoleCell *cell, LCD_consoleCell value)
+{
+    if ((*cell & ~CONSOLE_DIRTY) != value) *cell = value | CONSOLE_DIRTY;
+}
+
+void LCD_console::_clear(uint8_t row, uint8_t column1, uint8_t column2)
+{
+    LCD_consoleCell *cell = _line(row);
+    // Cleared cells take the current colours
+    LCD_consoleCell blank = ' ' | ((LCD_consoleCell)_attribute << 8);
+
+    for (uint8_t column = column1; column <= column2; column++) _set(cell + column, blank);
+}
+
+void LCD_console::_putChar(uint8_t c)
+{
+    if (_column >= _columns) {
+        _column = 0;
+        _lineFeed();
+    }
+    _set(_line(_row) + _column, c | ((LCD_consoleCell)_attribute << 8));
+    _column++;
+}
+
+void LCD_console::_putUTF8()
+{
+    uint16_t k = 0;
+
+    while (k < _utf8Count) _putChar(utf8Next(_utf8, _utf8Count, &k));
+    _utf8Count = 0;
+}
+
+void LCD_console::_lineFeed()
+{
+    if (_row + 1 < _rows) {
+        _row++;
+        return;
+    }
+
+    // The screen shows the grid: only the new last row has to be drawn
+    update();
+
+    LCD_consoleCell *first = _line(0);
+    LCD_consoleCell *last  = _line(_rows - 1);
+    uint8_t row, column;
+
+    if (_scrollMode != SCROLL_HARDWARE) {
+        if (_scrollMode == SCROLL_COPY) {
+            _screen->copyPaste(0, _font->height, 0, 0, _columns * _font->width, (_rows - 1) * _font->height);
+        } else {
+            // Each screen row gets the cells of the next one: redraw those that differ
+            for (row = 0; row + 1 < _rows; row++) {
+                LCD_consoleCell *current = _line(row);
+                LCD_consoleCell *next = _line(row + 1);
+                for (column = 0; column < _columns; column++) {
+                    // Without the dirty marks, or one row marks the next one down the screen
+                    if ((next[column] & ~CONSOLE_DIRTY) != (current[column] & ~CONSOLE_DIRTY)) next[column] |= CONSOLE_DIRTY;
+                }
+            }
+        }
+        // The first row becomes the last one, where the screen still shows the previous last row
+        memcpy(first, last, _columns * sizeof(LCD_consoleCell));
+    }
+    // With the hardware scroll, the first row keeps its GRAM position and moves to the bottom
+
+    _top = (_top + 1) % _rows;
+    _clear(_rows - 1, 0, _columns - 1);
+    if (_scrollMode == SCROLL_HARDWARE) _screen->setScroll((uint16_t)_top * _font->height, true);
+}
+
+void LCD_console::_escapeChar(uint8_t c)
+{
+    if (_escape == 1) {
+        // ESC [ starts a control sequence, other escapes are ignored
+        _escape = (c == '[') ? 2 : 0;
+        _count = 0;
+        _parameters[0] = _parameters[1] = _parameters[2] = _parameters[3] = 0;
+        return;
+    }
+
+    if ((c >= '0') && (c <= '9')) {
+        if ((_count < 4) && (_parameters[_count] < 1000)) _parameters[_count] = _parameters[_count] * 10 + (c - '0');
+        return;
+    }
+    if (c == ';') {
+        if (_count < 4) _count++;
+        return;
+    }
+
+    _escape = 0;
+    switch (c) {
+        case 'm':
+            for (uint8_t k = 0; (k <= _count) && (k < 4); k++) _selectGraphics(_parameters[k]);
+            break;
+        case 'H':
+        case 'f':
+            setCursor((_parameters[1] > 0) ? _parameters[1] - 1 : 0, (_parameters[0] > 0) ? _parameters[0] - 1 : 0);
+            break;
+        case 'K':
+            if (_parameters[0] == 0) {
+                if (_column < _columns) _clear(_row, _column, _columns - 1);
+            } else if (_parameters[0] == 1) {
+                _clear(_row, 0, min(_column, _columns - 1));
+            } else if (_parameters[0] == 2) {
+                _clear(_row, 0, _columns - 1);
+            }
+            break;
+        case 'J':
+            if (_parameters[0] == 2) {
+                for (uint8_t row = 0; row < _rows; row++) _clear(row, 0, _columns - 1);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void LCD_console::_selectGraphics(uint16_t parameter)
+{
+    if (parameter == 0) {
+        _attribute = CONSOLE_DEFAULT;
+    } else if (parameter == 1) {
+        _attribute |= CONSOLE_BRIGHT;
+    } else if (parameter == 22) {
+        _attribute &= ~CONSOLE_BRIGHT;
+    } else if ((parameter >= 30) && (parameter <= 37)) {
+        _attribute = (_attribute & ~(CONSOLE_BRIGHT | 0x07)) | (parameter - 30);
+    } else if (parameter == 39) {
+        _attribute = (_attribute & ~(CONSOLE_BRIGHT | 0x07)) | CONSOLE_DEFAULT;
+    } else if ((parameter >= 40) && (parameter <= 47)) {
+        _attribute = (_attribute & ~0x38) | ((parameter - 40) << 3);
+    } else if (parameter == 49) {
+        _attribute &= ~0x38;
+    } else if ((parameter >= 90) && (parameter <= 97)) {
+        _attribute = (_attribute & ~0x07) | CONSOLE_BRIGHT | (parameter - 90);
+    }
+}
+
+void LCD_console::update()
+{
+    if (_screen == NULL) return;
+
+    const LCD_font *font = _screen->getFont();
+    bool fontSolid = _screen->isFontSolid();
+    _screen->setFont(_font);
+    _screen->setFontSolid(true);
+
+    for (uint8_t line = 0; line < _rows; line++) {
+        LCD_consoleCell *cell = _cells + (uint16_t)line * _columns;
+        uint8_t column = 0;
+
+        while (column < _columns) {
+            if ((cell[column] & CONSOLE_DIRTY) == 0) {
+                column++;
+                continue;
+            }
+            // Dirty cells of the same colours, with short clean gaps
+            uint8_t attribute = (cell[column] >> 8) & 0x7F;
+            uint8_t end = column + 1;
+            for (uint8_t n = column + 1; n < _columns; n++) {
+                if (((cell[n] >> 8) & 0x7F) != attribute) break;
+                if (cell[n] & CONSOLE_DIRTY) end = n + 1;
+                else if (n - end >= CONSOLE_GAP) break;
+            }
+            _drawRun(line, column, end - column);
+            column = end;
+        }
+    }
+    _screen->setFont(font);
+    _screen->setFontSolid(fontSolid);
+}
+
+// Draw cells of a grid line, given in storage order
+void LCD_console::_drawRun(uint8_t line, uint8_t column, uint8_t length)
+{
+    LCD_consoleCell *cell = _cells + (uint16_t)line * _columns + column;
+    uint8_t attribute = (*cell >> 8) & 0x7F;
+    uint16_t textColour = _palette[(attribute & 0x07) + ((attribute & CONSOLE_BRIGHT) ? 8 : 0)];
+    uint16_t backColour = _palette[(attribute >> 3) & 0x07];
+    uint16_t x = (uint16_t)column * _font->width;
+    uint16_t y;
+    char text[2 * CONSOLE_RUN];
+    uint8_t n, length8;
+
+    // With the hardware scroll, grid lines keep their GRAM rows
+    if (_scrollMode == SCROLL_HARDWARE) y = (uint16_t)line * _font->height;
+    else y = (uint16_t)((line + _rows - _top) % _rows) * _font->height;
+
+    while (length > 0) {
+        n = min(length, CONSOLE_RUN);
+        length8 = 0;
+        for (uint8_t k = 0; k < n; k++) {
+            // Cells hold Latin-1 codes, sent as UTF-8 like any text
+            uint8_t c = *cell & 0xFF;
+            if (c < 0x80) {
+                text[length8++] = c;
+            } else {
+                text[length8++] = 0xC0 | (c >> 6);
+                text[length8++] = 0x80 | (c & 0x3F);
+            }
+            *cell++ &= ~CONSOLE_DIRTY;
+        }
+        _screen->gTextLength(x, y, text, length8, textColour, backColour);
+        x += (uint16_t)n * _font->width;
+        length -= n;
+    }
+}
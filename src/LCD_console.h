@@ -0,0 +1,126 @@
+// LCD_console.h
+//
+// Scrolling text console for LCD_screen_font based displays
+//
+// The console keeps a grid of character cells, each one a character and an
+// attribute byte with the colours and a dirty bit. Printing only updates the
+// grid; the cells whose content changed are then redrawn, in runs sent as one
+// text window each.
+//
+// A line feed on the last row scrolls the console by one row:
+// * with the hardware scroll of the screen when the console covers the whole
+//   screen, as with the SSD2119 gate scan start in orientations 1 and 3,
+// * with copyPaste() when the screen can read back its GRAM,
+// * otherwise by redrawing the cells that differ from the row above.
+// With the hardware scroll, the grid rows form a ring that maps directly
+// onto the GRAM, so a new line costs one text row of bus traffic.
+//
+// Text is UTF-8: each character takes one cell, with its Latin-1 code.
+//
+// Supported ANSI sequences, ESC [ ... :
+// * m: 0 reset, 1 bright, 22 normal, 30-37 and 90-97 foreground, 39 default,
+//   40-47 background, 49 default
+// * H or f: cursor to row;column, from 1;1
+// * K: clear line, 0 to the end, 1 from the start, 2 whole line
+// * J: 2 clear the console
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include "Energia.h"
+
+#ifndef LCD_CONSOLE_RELEASE
+///
+/// @brief	Library release number
+///
+#define LCD_CONSOLE_RELEASE 100
+
+#include "LCD_screen_font.h"
+
+///
+/// @brief      Console cell: character in the low byte, attribute in the high byte
+/// @details    Attribute bits 0-2 foreground, 3-5 background, 6 bright foreground, 7 dirty
+///
+typedef uint16_t LCD_consoleCell;
+
+///
+/// @brief      Text console with dirty cells, ANSI colours and hardware scroll
+///
+class LCD_console : public Print {
+public:
+
+    ///
+    /// @brief	Constructor
+    ///
+    LCD_console();
+
+    ///
+    /// @brief	Attach the console to a screen
+    /// @param	screen pointer to the screen, with the font of the console already selected
+    /// @param	cells columns * rows cells, statically allocated by the caller
+    /// @param	columns number of columns
+    /// @param	rows number of rows
+    /// @note   The console starts at (0, 0) and uses a fixed-cell font.
+    /// @n      It clears the screen area and resets the hardware scroll.
+    ///
+    void begin(LCD_screen_font *screen, LCD_consoleCell *cells, uint8_t columns, uint8_t rows);
+
+    ///
+    /// @brief	Clear the console and move the cursor home
+    ///
+    void clear();
+
+    ///
+    /// @brief	Move the cursor
+    /// @param	column from 0
+    /// @param	row from 0
+    ///
+    void setCursor(uint8_t column, uint8_t row);
+
+    ///
+    /// @brief	Redraw the cells changed since the last update
+    /// @note   Called at the end of each write.
+    ///
+    void update();
+
+    ///
+    /// @brief	Print one character
+    ///
+    virtual size_t write(uint8_t c);
+
+    ///
+    /// @brief	Print a buffer, then update the screen
+    ///
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    using Print::write;
+
+private:
+    enum {SCROLL_REDRAW = 0, SCROLL_COPY = 1, SCROLL_HARDWARE = 2};
+
+    LCD_screen_font *_screen;
+    const LCD_font *_font;
+    LCD_consoleCell *_cells;
+    uint8_t _columns, _rows;
+    uint8_t _column, _row, _top;
+    uint8_t _attribute;
+    uint8_t _scrollMode;
+    uint8_t _escape;
+    uint16_t _parameters[4];
+    uint8_t _count;
+    char _utf8[4];
+    uint8_t _utf8Count;
+
+    LCD_consoleCell *_line(uint8_t row);
+    void _set(LCD_consoleCell *cell, LCD_consoleCell value);
+    void _clear(uint8_t row, uint8_t column1, uint8_t column2);
+    void _putChar(uint8_t c);
+    void _putUTF8();
+    void _lineFeed();
+    void _escapeChar(uint8_t c);
+    void _selectGraphics(uint16_t parameter);
+    void _drawRun(uint8_t line, uint8_t column, uint8_t length);
+};
+
+#endif
@@ -0,0 +1,74 @@
+// LCD_font.h
+//
+// Compressed font format for LCD_screen_font
+//
+// Each glyph is trimmed to the bounding box of its lit pixels. A glyph record is
+// * byte 0: left column of the box << 4 | (box width - 1)
+// * fonts up to 16 rows, byte 1: top row of the box << 4 | (box height - 1)
+// * taller fonts, byte 1: top row of the box, byte 2: box height
+// * then the box pixels, row-major, bit-packed LSB first, 1 = lit.
+// Blank glyphs have no record. The index gives the start of each record in the
+// data array, with one extra entry for the end of the last record: a byte
+// offset from the 16-bit base of its block of 1 << block glyphs.
+//
+// Fonts whose boxes would take more than whole cells, as the 6 x 8 font, have
+// no index: each glyph is its whole cell, row-major, bit-packed LSB first.
+//
+// Proportional fonts add the advance of each glyph, in pixels. Their width is
+// the largest advance. Fixed-cell fonts advance by their width.
+//
+// Fonts are generated by extras/Tools/font_compress.py, which also writes subset
+// fonts limited to a range of characters, for setFont(), and converted from BDF
+// files by extras/Tools/bdf_convert.py.
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include "Energia.h"
+
+#ifndef LCD_FONT_RELEASE
+///
+/// @brief	Library release number
+///
+#define LCD_FONT_RELEASE 101
+
+///
+/// @brief	Built-in fonts limited to characters 0x20 to 0x7E
+/// @note   Uncomment to save the flash used by the Latin-1 glyphs.
+///
+// #define LCD_FONT_ASCII_ONLY
+
+///
+/// @brief      Compressed font
+///
+typedef struct LCD_font {
+    uint8_t width;              ///< cell width, 16 pixels max
+    uint8_t height;             ///< cell height, 24 pixels max
+    uint8_t first;              ///< first character
+    uint8_t last;               ///< last character
+    uint8_t block;              ///< glyphs per base, log2
+    const uint16_t *bases;      ///< base of each block into data, NULL for whole cells
+    const uint8_t *offsets;     ///< last - first + 2 offsets from their base, NULL for whole cells
+    const uint8_t *data;        ///< glyph records
+    const uint8_t *advances;    ///< last - first + 1 advances, NULL for fixed cells
+} LCD_font;
+
+///
+/// @brief      Box of a glyph, decoded from its record
+///
+typedef struct LCD_glyph {
+    const uint8_t *bits;        ///< box pixels, row-major, bit-packed LSB first
+    uint8_t left;               ///< left column of the box
+    uint8_t width;              ///< box width
+    uint8_t top;                ///< top row of the box
+    uint8_t height;             ///< box height, 0 for a blank glyph
+} LCD_glyph;
+
+///
+/// @brief	Box header of 2 bytes for fonts up to this height
+///
+#define LCD_FONT_SHORT 16
+
+#endif
@@ -0,0 +1,226 @@
+// LCD_gauge.cpp
+//
+// Analog gauge for LCD_screen based displays
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+// Library header
+#include "LCD_gauge.h"
+
+// Coordinates of radius * (cos, sin) of angle, rounded
+static int16_t _polarX(uint16_t radius, uint16_t angle)
+{
+    return ((int32_t)radius * cosQ15(angle) + 0x4000) >> 15;
+}
+
+static int16_t _polarY(uint16_t radius, uint16_t angle)
+{
+    return ((int32_t)radius * sinQ15(angle) + 0x4000) >> 15;
+}
+
+// Code
+LCD_gauge::LCD_gauge()
+{
+    _screen  = NULL;
+    _x0 = _y0 = _radius = 0;
+    _minimum = 0;
+    _maximum = 100;
+    _value   = 0;
+    _ticks   = 10;
+    setAngles();
+    setColours(blackColour, whiteColour, redColour, grayColour);
+    _length = 0;
+    _width  = 0;
+    _needle.top    = 1;
+    _needle.bottom = 0;
+}
+
+void LCD_gauge::begin(LCD_screen *screen, uint16_t x0, uint16_t y0, uint16_t radius)
+{
+    _screen = screen;
+    _x0 = x0;
+    _y0 = y0;
+    _radius = radius;
+    // Needle inside the ticks, ticks are radius / 8 long
+    setNeedle(radius - radius / 8 - 4, max(radius / 24, 2));
+}
+
+void LCD_gauge::setScale(int16_t minimum, int16_t maximum, uint8_t ticks)
+{
+    if (maximum == minimum) maximum = minimum + 1;
+    if (maximum < minimum) {
+        int16_t w = minimum;
+        minimum = maximum;
+        maximum = w;
+    }
+    _minimum = minimum;
+    _maximum = maximum;
+    _ticks   = max(ticks, 1);
+}
+
+void LCD_gauge::setAngles(uint16_t start, uint16_t sweep)
+{
+    _start = start;
+    _sweep = sweep;
+}
+
+void LCD_gauge::setColours(uint16_t dialColour, uint16_t tickColour, uint16_t needleColour, uint16_t hubColour)
+{
+    _dialColour   = dialColour;
+    _tickColour   = tickColour;
+    _needleColour = needleColour;
+    _hubColour    = hubColour;
+}
+
+void LCD_gauge::setNeedle(uint16_t length, uint8_t width)
+{
+    _length = length;
+    _width  = width;
+}
+
+void LCD_gauge::drawFace()
+{
+    if (_screen == NULL) return;
+
+    bool penSolid = _screen->isPenSolid();
+    uint16_t tick = _radius / 8;
+
+    _screen->setPenSolid(true);
+    _screen->circle(_x0, _y0, _radius, _dialColour);
+    _screen->setPenSolid(false);
+    _screen->circle(_x0, _y0, _radius, _tickColour);
+    for (uint8_t k = 0; k <= _ticks; k++) {
+        uint16_t angle = _start + (uint32_t)_sweep * k / _ticks;
+        _screen->line(_x0 + _polarX(_radius - 2, angle), _y0 + _polarY(_radius - 2, angle),
+                      _x0 + _polarX(_radius - 2 - tick, angle), _y0 + _polarY(_radius - 2 - tick, angle),
+                      _tickColour);
+    }
+
+    // The dial is known again: the needle is drawn from nothing
+    Needle none;
+    none.top    = 1;
+    none.bottom = 0;
+    _screen->setPenSolid(true);
+    _makeNeedle(_needle, _angle(_value));
+    _drawNeedle(none);
+    _screen->setPenSolid(penSolid);
+}
+
+void LCD_gauge::setValue(int16_t value)
+{
+    _value = value;
+    if (_screen == NULL) return;
+
+    Needle previous = _needle;
+    _makeNeedle(_needle, _angle(value));
+    if ((memcmp(_needle.x, previous.x, sizeof(_needle.x)) == 0) &&
+        (memcmp(_needle.y, previous.y, sizeof(_needle.y)) == 0)) return;
+
+    bool penSolid = _screen->isPenSolid();
+    _screen->setPenSolid(true);
+    _drawNeedle(previous);
+    _screen->setPenSolid(penSolid);
+}
+
+int16_t LCD_gauge::getValue()
+{
+    return _value;
+}
+
+uint16_t LCD_gauge::_angle(int16_t value)
+{
+    value = constrain(value, _minimum, _maximum);
+    return _start + (uint32_t)_sweep * (uint16_t)(value - _minimum) / (uint16_t)(_maximum - _minimum);
+}
+
+uint8_t LCD_gauge::_hub()
+{
+    return _width + 2;
+}
+
+// Tip, side, tail and side, in that order around the needle
+void LCD_gauge::_makeNeedle(Needle &needle, uint16_t angle)
+{
+    uint16_t side = angle + 0x4000;
+
+    needle.x[0] = _x0 + _polarX(_length, angle);
+    needle.y[0] = _y0 + _polarY(_length, angle);
+    needle.x[1] = _x0 + _polarX(_width, side);
+    needle.y[1] = _y0 + _polarY(_width, side);
+    needle.x[2] = _x0 - _polarX(2 * _width, angle);
+    needle.y[2] = _y0 - _polarY(2 * _width, angle);
+    needle.x[3] = _x0 - _polarX(_width, side);
+    needle.y[3] = _y0 - _polarY(_width, side);
+
+    needle.top = needle.bottom = needle.y[0];
+    for (uint8_t i = 0; i < 4; i++) {
+        uint8_t j = (i + 1) & 0x03;
+        int16_t dy = needle.y[j] - needle.y[i];
+        needle.slope[i] = (dy != 0) ? ((int32_t)(needle.x[j] - needle.x[i]) << 16) / dy : 0;
+        needle.top    = min(needle.top, needle.y[i]);
+        needle.bottom = max(needle.bottom, needle.y[i]);
+    }
+}
+
+// Span of a row across the convex needle, from the edges crossing the row
+bool LCD_gauge::_span(const Needle &needle, int16_t y, int16_t &left, int16_t &right)
+{
+    if ((y < needle.top) || (y > needle.bottom)) return false;
+
+    left  = 0x7FFF;
+    right = -0x7FFF;
+    for (uint8_t i = 0; i < 4; i++) {
+        uint8_t j = (i + 1) & 0x03;
+        int16_t y1 = min(needle.y[i], needle.y[j]);
+        int16_t y2 = max(needle.y[i], needle.y[j]);
+        if ((y < y1) || (y > y2)) continue;
+
+        int16_t x;
+        if (y1 == y2) {
+            left  = min(left, min(needle.x[i], needle.x[j]));
+            right = max(right, max(needle.x[i], needle.x[j]));
+            continue;
+        }
+        x = needle.x[i] + (((int32_t)(y - needle.y[i]) * needle.slope[i] + 0x8000) >> 16);
+        left  = min(left, x);
+        right = max(right, x);
+    }
+    return (left <= right);
+}
+
+void LCD_gauge::_fill(int16_t y, int16_t left, int16_t right, uint16_t colour)
+{
+    if ((y < 0) || (right < 0) || (left > right)) return;
+    _screen->rectangle(max(left, 0), y, right, y, colour);
+}
+
+// New needle row by row, and the dial back where only the previous needle was
+void LCD_gauge::_drawNeedle(const Needle &previous)
+{
+    int16_t top    = min(previous.top, _needle.top);
+    int16_t bottom = max(previous.bottom, _needle.bottom);
+    int16_t left, right, oldLeft, oldRight;
+
+    if (previous.top > previous.bottom) {
+        top    = _needle.top;
+        bottom = _needle.bottom;
+    }
+    for (int16_t y = top; y <= bottom; y++) {
+        bool flag = _span(_needle, y, left, right);
+        bool flagOld = (previous.top <= previous.bottom) && _span(previous, y, oldLeft, oldRight);
+
+        if (flagOld) {
+            if (!flag) {
+                _fill(y, oldLeft, oldRight, _dialColour);
+            } else {
+                if (oldLeft < left) _fill(y, oldLeft, min(oldRight, left - 1), _dialColour);
+                if (oldRight > right) _fill(y, max(oldLeft, right + 1), oldRight, _dialColour);
+            }
+        }
+        if (flag) _fill(y, left, right, _needleColour);
+    }
+    _screen->circle(_x0, _y0, _hub(), _hubColour);
+}
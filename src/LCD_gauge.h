@@ -0,0 +1,114 @@
+// LCD_gauge.h
+//
+// Analog gauge for LCD_screen based displays
+//
+// The face, dial, rim, ticks and hub, is drawn once. The needle is a convex
+// quadrilateral, tip, sides and tail, kept as its corners and edge slopes for
+// the current angle. A new value fills the new needle row by row with the
+// scanline filler, and only the pixels of the old needle left outside the new
+// one get the dial colour back. The needle only covers the plain dial, inside
+// the ticks, so the face is known without read-back.
+//
+// Angles are binary, 65536 per turn, clockwise from 3 o'clock, see sinQ15().
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include "Energia.h"
+
+#ifndef LCD_GAUGE_RELEASE
+///
+/// @brief	Library release number
+///
+#define LCD_GAUGE_RELEASE 100
+
+#include "LCD_screen.h"
+
+///
+/// @brief      Dial with a needle redrawn on its own
+///
+class LCD_gauge {
+public:
+
+    ///
+    /// @brief	Constructor
+    ///
+    LCD_gauge();
+
+    ///
+    /// @brief	Attach the gauge to a screen
+    /// @param	screen pointer to the screen
+    /// @param	x0 centre x
+    /// @param	y0 centre y
+    /// @param	radius radius of the dial, pixels
+    ///
+    void begin(LCD_screen *screen, uint16_t x0, uint16_t y0, uint16_t radius);
+
+    ///
+    /// @brief	Scale of the gauge
+    /// @param	minimum value at the start of the scale
+    /// @param	maximum value at the end of the scale
+    /// @param	ticks number of intervals between ticks
+    ///
+    void setScale(int16_t minimum, int16_t maximum, uint8_t ticks = 10);
+
+    ///
+    /// @brief	Angles of the scale
+    /// @param	start angle of the minimum, default 135 degrees, bottom left
+    /// @param	sweep clockwise angle to the maximum, default 270 degrees
+    ///
+    void setAngles(uint16_t start = 0x6000, uint16_t sweep = 0xC000);
+
+    ///
+    /// @brief	Set the colours
+    ///
+    void setColours(uint16_t dialColour, uint16_t tickColour, uint16_t needleColour, uint16_t hubColour);
+
+    ///
+    /// @brief	Size of the needle
+    /// @param	length from the centre to the tip, inside the ticks
+    /// @param	width half width at the hub
+    ///
+    void setNeedle(uint16_t length, uint8_t width);
+
+    ///
+    /// @brief	Draw the whole gauge: face and needle
+    /// @note   Labels drawn by the sketch must stay outside the needle circle.
+    ///
+    void drawFace();
+
+    ///
+    /// @brief	Move the needle, only the pixels that change are drawn
+    ///
+    void setValue(int16_t value);
+    int16_t getValue();
+
+private:
+    // Convex needle: corners and slopes of the edges in 16.16
+    struct Needle {
+        int16_t x[4], y[4];
+        int32_t slope[4];
+        int16_t top, bottom;
+    };
+
+    LCD_screen *_screen;
+    uint16_t _x0, _y0, _radius;
+    int16_t _minimum, _maximum, _value;
+    uint8_t _ticks;
+    uint16_t _start, _sweep;
+    uint16_t _dialColour, _tickColour, _needleColour, _hubColour;
+    uint16_t _length;
+    uint8_t _width;
+    Needle _needle;
+
+    uint16_t _angle(int16_t value);
+    uint8_t _hub();
+    void _makeNeedle(Needle &needle, uint16_t angle);
+    bool _span(const Needle &needle, int16_t y, int16_t &left, int16_t &right);
+    void _fill(int16_t y, int16_t left, int16_t right, uint16_t colour);
+    void _drawNeedle(const Needle &previous);
+};
+
+#endif
@@ -0,0 +1,137 @@
+// LCD_hitmap.cpp
+//
+// Spatial index of the touch regions of a screen
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+// Library header
+#include "LCD_hitmap.h"
+
+// Highest bit set of a non-null word, by halves
+static uint8_t _highestBit(uint32_t bits)
+{
+    uint8_t k = 0;
+
+    if (bits & 0xFFFF0000) {
+        bits >>= 16;
+        k += 16;
+    }
+    if (bits & 0xFF00) {
+        bits >>= 8;
+        k += 8;
+    }
+    if (bits & 0xF0) {
+        bits >>= 4;
+        k += 4;
+    }
+    if (bits & 0x0C) {
+        bits >>= 2;
+        k += 2;
+    }
+    if (bits & 0x02) k += 1;
+    return k;
+}
+
+// Code
+LCD_hitmap::LCD_hitmap()
+{
+    _screen = NULL;
+    _scaleX = _scaleY = 0;
+    clear();
+}
+
+void LCD_hitmap::begin(LCD_screen *screen)
+{
+    _screen = screen;
+    // Rounded down, so the last pixel falls in the last cell
+    _scaleX = ((uint32_t)LCD_HITMAP_COLUMNS << 16) / _screen->screenSizeX();
+    _scaleY = ((uint32_t)LCD_HITMAP_ROWS << 16) / _screen->screenSizeY();
+    clear();
+}
+
+bool LCD_hitmap::add(uint8_t region, uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    if ((region >= LCD_HITMAP_REGIONS) || (dx == 0) || (dy == 0)) return false;
+
+    remove(region);
+    _x0[region] = x0;
+    _y0[region] = y0;
+    _x1[region] = x0 + dx - 1;
+    _y1[region] = y0 + dy - 1;
+    _used[region / 32] |= (uint32_t)1 << (region % 32);
+    _mark(region, true);
+    return true;
+}
+
+void LCD_hitmap::remove(uint8_t region)
+{
+    if (region >= LCD_HITMAP_REGIONS) return;
+
+    uint32_t bit = (uint32_t)1 << (region % 32);
+    if ((_used[region / 32] & bit) == 0) return;
+    _mark(region, false);
+    _used[region / 32] &= ~bit;
+}
+
+void LCD_hitmap::clear()
+{
+    memset(_cells, 0, sizeof(_cells));
+    memset(_used, 0, sizeof(_used));
+}
+
+uint8_t LCD_hitmap::find(uint16_t x, uint16_t y)
+{
+    const uint32_t *cell = _cells[_row(y) * LCD_HITMAP_COLUMNS + _column(x)];
+
+    // Candidates of the cell, from the topmost one
+    for (int8_t word = WORDS - 1; word >= 0; word--) {
+        uint32_t bits = cell[word];
+        while (bits) {
+            uint8_t k = _highestBit(bits);
+            uint8_t region = word * 32 + k;
+            if ((x >= _x0[region]) && (x <= _x1[region]) && (y >= _y0[region]) && (y <= _y1[region])) return region;
+            bits &= ~((uint32_t)1 << k);
+        }
+    }
+    return LCD_HITMAP_NONE;
+}
+
+bool LCD_hitmap::getTouch(uint8_t &region, uint16_t &x, uint16_t &y, uint16_t &z)
+{
+    region = LCD_HITMAP_NONE;
+    if ((_screen == NULL) || !_screen->getTouch(x, y, z)) return false;
+    region = find(x, y);
+    return true;
+}
+
+// Set or clear the bit of a region in the cells it covers
+void LCD_hitmap::_mark(uint8_t region, bool flag)
+{
+    uint8_t word = region / 32;
+    uint32_t bit = (uint32_t)1 << (region % 32);
+    uint8_t column0 = _column(_x0[region]), column1 = _column(_x1[region]);
+    uint8_t row1 = _row(_y1[region]);
+
+    for (uint8_t row = _row(_y0[region]); row <= row1; row++) {
+        for (uint8_t column = column0; column <= column1; column++) {
+            uint32_t *cell = _cells[row * LCD_HITMAP_COLUMNS + column];
+            if (flag) cell[word] |= bit;
+            else cell[word] &= ~bit;
+        }
+    }
+}
+
+uint8_t LCD_hitmap::_column(uint16_t x)
+{
+    uint32_t column = (x * _scaleX) >> 16;
+    return (column < LCD_HITMAP_COLUMNS) ? column : LCD_HITMAP_COLUMNS - 1;
+}
+
+uint8_t LCD_hitmap::_row(uint16_t y)
+{
+    uint32_t row = (y * _scaleY) >> 16;
+    return (row < LCD_HITMAP_ROWS) ? row : LCD_HITMAP_ROWS - 1;
+}
@@ -0,0 +1,120 @@
+// LCD_hitmap.h
+//
+// Spatial index of the touch regions of a screen
+//
+// The screen is divided into a coarse grid of LCD_HITMAP_COLUMNS x
+// LCD_HITMAP_ROWS cells, each one with a bitset of the regions overlapping
+// it. A touch point selects one cell, then only the regions of that cell are
+// tested, from the topmost one: the cost no longer grows with the number of
+// regions of the screen.
+//
+// Regions are numbered from 0 to LCD_HITMAP_REGIONS - 1, and a higher number
+// is on top. Adding or removing a region only updates the cells it covers.
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include "Energia.h"
+
+#ifndef LCD_HITMAP_RELEASE
+///
+/// @brief	Library release number
+///
+#define LCD_HITMAP_RELEASE 100
+
+#include "LCD_screen.h"
+
+///
+/// @brief	Number of regions, a multiple of 32, may be defined before the include
+///
+#ifndef LCD_HITMAP_REGIONS
+#define LCD_HITMAP_REGIONS 64
+#endif
+
+///
+/// @brief	Grid of the index
+///
+#define LCD_HITMAP_COLUMNS 8
+#define LCD_HITMAP_ROWS    6
+
+///
+/// @brief	No region at that point
+///
+#define LCD_HITMAP_NONE 0xFF
+
+///
+/// @brief      Touch regions with a grid index
+///
+class LCD_hitmap {
+public:
+
+    ///
+    /// @brief	Constructor
+    ///
+    LCD_hitmap();
+
+    ///
+    /// @brief	Attach the index to a screen and remove all regions
+    /// @param	screen pointer to the screen, in the orientation of the regions
+    ///
+    void begin(LCD_screen *screen);
+
+    ///
+    /// @brief	Add or move a region
+    /// @param	region number, 0 to LCD_HITMAP_REGIONS - 1, higher numbers on top
+    /// @param	x0 left
+    /// @param	y0 top
+    /// @param	dx width, pixels
+    /// @param	dy height, pixels
+    /// @return	false if the region number or the size is invalid
+    ///
+    bool add(uint8_t region, uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+    ///
+    /// @brief	Remove a region
+    /// @param	region number
+    ///
+    void remove(uint8_t region);
+
+    ///
+    /// @brief	Remove all regions
+    ///
+    void clear();
+
+    ///
+    /// @brief	Topmost region at a point
+    /// @param	x screen x
+    /// @param	y screen y
+    /// @return	region number, or LCD_HITMAP_NONE
+    ///
+    uint8_t find(uint16_t x, uint16_t y);
+
+    ///
+    /// @brief	Touch of the screen, with the region touched
+    /// @param	region region number, or LCD_HITMAP_NONE
+    /// @param	x screen x
+    /// @param	y screen y
+    /// @param	z pressure
+    /// @return	true if the screen is touched, as LCD_screen::getTouch()
+    ///
+    bool getTouch(uint8_t &region, uint16_t &x, uint16_t &y, uint16_t &z);
+
+private:
+    enum {WORDS = LCD_HITMAP_REGIONS / 32};
+
+    LCD_screen *_screen;
+    // Cell of x is (x * _scaleX) >> 16, without division
+    uint32_t _scaleX, _scaleY;
+    uint32_t _cells[LCD_HITMAP_ROWS * LCD_HITMAP_COLUMNS][WORDS];
+    uint32_t _used[WORDS];
+    uint16_t _x0[LCD_HITMAP_REGIONS], _y0[LCD_HITMAP_REGIONS];
+    uint16_t _x1[LCD_HITMAP_REGIONS], _y1[LCD_HITMAP_REGIONS];
+
+    void _mark(uint8_t region, bool flag);
+    uint8_t _column(uint16_t x);
+    uint8_t _row(uint16_t y);
+};
+
+#endif
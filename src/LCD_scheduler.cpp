@@ -0,0 +1,202 @@
+// LCD_scheduler.cpp
+//
+// Cooperative scheduler for LCD_screen based sketches
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+// Library header
+#include "LCD_scheduler.h"
+
+static uint32_t _size(const LCD_area &area)
+{
+    return (uint32_t)(area.x2 - area.x1 + 1) * (area.y2 - area.y1 + 1);
+}
+
+static LCD_area _bound(const LCD_area &a, const LCD_area &b)
+{
+    LCD_area area;
+    area.x1 = min(a.x1, b.x1);
+    area.y1 = min(a.y1, b.y1);
+    area.x2 = max(a.x2, b.x2);
+    area.y2 = max(a.y2, b.y2);
+    return area;
+}
+
+static bool _overlap(const LCD_area &a, const LCD_area &b)
+{
+    return (a.x1 <= b.x2) && (b.x1 <= a.x2) && (a.y1 <= b.y2) && (b.y1 <= a.y2);
+}
+
+// Code
+LCD_scheduler::LCD_scheduler()
+{
+    _updateCount = 0;
+    _render = NULL;
+    _tick  = 20000;
+    _frame = 40000;
+    _nextTick = _lastFrame = 0;
+    _areaCount = 0;
+    resetStatistics();
+}
+
+void LCD_scheduler::begin(uint32_t tick, uint32_t frame)
+{
+    _tick  = max(tick, 1);
+    _frame = frame;
+    _nextTick  = micros() + _tick;
+    _lastFrame = micros() - _frame;
+    resetStatistics();
+}
+
+bool LCD_scheduler::addUpdate(LCD_updateFunction update)
+{
+    if (_updateCount >= LCD_SCHEDULER_UPDATES) return false;
+    _updates[_updateCount++] = update;
+    return true;
+}
+
+void LCD_scheduler::setRender(LCD_renderFunction render)
+{
+    _render = render;
+}
+
+void LCD_scheduler::invalidate(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    if ((dx == 0) || (dy == 0)) return;
+
+    LCD_area area;
+    area.x1 = x0;
+    area.y1 = y0;
+    area.x2 = x0 + dx - 1;
+    area.y2 = y0 + dy - 1;
+    _add(area);
+}
+
+void LCD_scheduler::run()
+{
+    uint32_t now = micros();
+    uint8_t row = 0;
+
+    // Ticks due, a few in a row at most
+    while ((int32_t)(now - _nextTick) >= 0) {
+        if (row++ == LCD_SCHEDULER_CATCHUP) {
+            _dropped += (now - _nextTick) / _tick + 1;
+            _nextTick = now + _tick;
+            break;
+        }
+        _late = max(_late, now - _nextTick);
+        for (uint8_t i = 0; i < _updateCount; i++) _updates[i]();
+        _ticks++;
+        _nextTick += _tick;
+        now = micros();
+    }
+
+    // One frame, once the frame period is over
+    if ((_render == NULL) || (_areaCount == 0) || (now - _lastFrame < _frame)) return;
+
+    // The render function may invalidate again what it leaves
+    LCD_area areas[LCD_SCHEDULER_AREAS];
+    uint8_t count = _areaCount;
+    memcpy(areas, _areas, count * sizeof(LCD_area));
+    _areaCount = 0;
+
+    _lastFrame = now;
+    _render(areas, count);
+    uint32_t duration = micros() - now;
+
+    // Halved before the total overflows, the average stays
+    if (_frameTotal > 0xFFFFFFFF - duration) {
+        _frameTotal /= 2;
+        _frames /= 2;
+    }
+    _frameTotal += duration;
+    _frames++;
+    _frameMinimum = min(_frameMinimum, duration);
+    _frameMaximum = max(_frameMaximum, duration);
+}
+
+uint32_t LCD_scheduler::timeLeft()
+{
+    int32_t left = _nextTick - micros();
+    return (left > 0) ? left : 0;
+}
+
+void LCD_scheduler::getFrameStatistics(uint32_t &frames, uint32_t &minimum, uint32_t &average, uint32_t &maximum)
+{
+    frames  = _frames;
+    minimum = (_frames > 0) ? _frameMinimum : 0;
+    average = (_frames > 0) ? _frameTotal / _frames : 0;
+    maximum = _frameMaximum;
+}
+
+void LCD_scheduler::getTickStatistics(uint32_t &ticks, uint32_t &dropped, uint32_t &late)
+{
+    ticks   = _ticks;
+    dropped = _dropped;
+    late    = _late;
+}
+
+void LCD_scheduler::resetStatistics()
+{
+    _frames = _frameTotal = 0;
+    _frameMinimum = 0xFFFFFFFF;
+    _frameMaximum = 0;
+    _ticks = _dropped = _late = 0;
+}
+
+// Merged with the areas it overlaps or completes into a rectangle, as long as
+// the merged area does. With no room left, the two areas, the new one included,
+// that add the fewest pixels once merged are merged, and the result added again.
+void LCD_scheduler::_add(LCD_area area)
+{
+    uint8_t i = 0;
+
+    while (i < _areaCount) {
+        LCD_area bound = _bound(area, _areas[i]);
+        if (_overlap(area, _areas[i]) || (_size(bound) == _size(area) + _size(_areas[i]))) {
+            area = bound;
+            _remove(i);
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    if (_areaCount == LCD_SCHEDULER_AREAS) {
+        // Index _areaCount stands for the new area
+        uint8_t first = 0, second = _areaCount;
+        uint32_t added = 0xFFFFFFFF;
+        for (i = 0; i < _areaCount; i++) {
+            for (uint8_t j = i + 1; j <= _areaCount; j++) {
+                const LCD_area &other = (j < _areaCount) ? _areas[j] : area;
+                uint32_t extra = _size(_bound(_areas[i], other)) - _size(_areas[i]) - _size(other);
+                if (extra < added) {
+                    added = extra;
+                    first = i;
+                    second = j;
+                }
+            }
+        }
+
+        LCD_area merged = _bound(_areas[first], (second < _areaCount) ? _areas[second] : area);
+        if (second < _areaCount) {
+            // Two kept areas: the new one takes one of their places
+            _remove(second);
+            _remove(first);
+            _areas[_areaCount++] = area;
+        } else {
+            _remove(first);
+        }
+        _add(merged);
+        return;
+    }
+    _areas[_areaCount++] = area;
+}
+
+void LCD_scheduler::_remove(uint8_t index)
+{
+    _areas[index] = _areas[--_areaCount];
+}
@@ -0,0 +1,153 @@
+// LCD_scheduler.h
+//
+// Cooperative scheduler for LCD_screen based sketches
+//
+// The simulation, or the control loop, runs at a fixed tick and the screen is
+// drawn at its own pace:
+// * Update functions are called at each tick, in order. When the sketch falls
+//   behind, up to LCD_SCHEDULER_CATCHUP ticks are run in a row, then the late
+//   ticks are dropped and counted, so the tick keeps its period.
+// * The render function is called at most once per frame, right after the
+//   ticks, when some areas of the screen are invalid. timeLeft() tells how long
+//   it can draw before the next tick; what it leaves can be invalidated again
+//   for the next frame.
+// * Invalid areas are kept until drawn, across the frames skipped: areas that
+//   overlap, or that form a rectangle together, are merged, so no pixel is
+//   drawn twice; with more than LCD_SCHEDULER_AREAS, the two that add the
+//   fewest pixels once merged are.
+//
+// Times are in microseconds, from micros().
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include "Energia.h"
+
+#ifndef LCD_SCHEDULER_RELEASE
+///
+/// @brief	Library release number
+///
+#define LCD_SCHEDULER_RELEASE 100
+
+///
+/// @brief	Update functions, invalid areas kept and late ticks run in a row
+///
+#ifndef LCD_SCHEDULER_UPDATES
+#define LCD_SCHEDULER_UPDATES 4
+#endif
+#ifndef LCD_SCHEDULER_AREAS
+#define LCD_SCHEDULER_AREAS 4
+#endif
+#ifndef LCD_SCHEDULER_CATCHUP
+#define LCD_SCHEDULER_CATCHUP 4
+#endif
+
+///
+/// @brief      Area of the screen, corners included
+///
+struct LCD_area {
+    uint16_t x1, y1, x2, y2;
+};
+
+///
+/// @brief      Update function, called at each tick
+///
+typedef void (*LCD_updateFunction)();
+
+///
+/// @brief      Render function, called with the invalid areas
+///
+typedef void (*LCD_renderFunction)(const LCD_area *areas, uint8_t count);
+
+///
+/// @brief      Fixed tick for the updates, frame budget for the screen
+///
+class LCD_scheduler {
+public:
+
+    ///
+    /// @brief	Constructor
+    ///
+    LCD_scheduler();
+
+    ///
+    /// @brief	Start the scheduler
+    /// @param	tick period of the updates, us
+    /// @param	frame minimum period of the frames, us
+    ///
+    void begin(uint32_t tick = 20000, uint32_t frame = 40000);
+
+    ///
+    /// @brief	Add an update function
+    /// @return	false if LCD_SCHEDULER_UPDATES are already there
+    ///
+    bool addUpdate(LCD_updateFunction update);
+
+    ///
+    /// @brief	Set the render function
+    ///
+    void setRender(LCD_renderFunction render);
+
+    ///
+    /// @brief	Mark an area to be drawn with the next frame
+    /// @param	x0 left
+    /// @param	y0 top
+    /// @param	dx width
+    /// @param	dy height
+    ///
+    void invalidate(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+    ///
+    /// @brief	Run the ticks due, then a frame if one is due
+    /// @note   To be called from loop() as often as possible.
+    ///
+    void run();
+
+    ///
+    /// @brief	Time before the next tick, us
+    /// @return	0 when a tick is due
+    ///
+    uint32_t timeLeft();
+
+    ///
+    /// @brief	Statistics since the start or the last reset
+    /// @param	frames number of frames drawn
+    /// @param	minimum shortest frame, us
+    /// @param	average average frame, us
+    /// @param	maximum longest frame, us
+    ///
+    void getFrameStatistics(uint32_t &frames, uint32_t &minimum, uint32_t &average, uint32_t &maximum);
+
+    ///
+    /// @brief	Statistics of the ticks since the start or the last reset
+    /// @param	ticks number of ticks run
+    /// @param	dropped number of ticks dropped
+    /// @param	late longest delay of a tick, us
+    ///
+    void getTickStatistics(uint32_t &ticks, uint32_t &dropped, uint32_t &late);
+
+    ///
+    /// @brief	Reset the statistics
+    ///
+    void resetStatistics();
+
+private:
+    LCD_updateFunction _updates[LCD_SCHEDULER_UPDATES];
+    uint8_t _updateCount;
+    LCD_renderFunction _render;
+    uint32_t _tick, _frame;
+    uint32_t _nextTick, _lastFrame;
+
+    LCD_area _areas[LCD_SCHEDULER_AREAS];
+    uint8_t _areaCount;
+
+    uint32_t _frames, _frameTotal, _frameMinimum, _frameMaximum;
+    uint32_t _ticks, _dropped, _late;
+
+    void _add(LCD_area area);
+    void _remove(uint8_t index);
+};
+
+#endif
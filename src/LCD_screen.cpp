@@ -27,31 +27,89 @@ LCD_screen::LCD_screen()
     _flagRead       = false;
     _flagStorage    = false;
     _touchTrim      = 0;
+    _touchOrientation = 0xFF;
+    memset(&_touchCalibration, 0, sizeof(_touchCalibration));
+}
+// Decimal digits of number, written at the end of buffer, no allocation
+static const char *_decimal(char *buffer, uint8_t size, uint16_t number)
+{
+    char *p = buffer + size - 1;
+    *p = '\0';
+    do {
+        *--p = '0' + number % 10;
+        number /= 10;
+    } while ((number > 0) && (p > buffer));
+    return p;
 }
 void LCD_screen::showInformation(uint16_t x0, uint16_t y0)
 {
+    char release[] = "release 0.00";
+    char buffer[6];
+    uint16_t x1;
+    release[8]  = '0' + LCD_SCREEN_RELEASE/100%10;
+    release[10] = '0' + LCD_SCREEN_RELEASE/10%10;
+    release[11] = '0' + LCD_SCREEN_RELEASE%10;
     setFontSize(2);
     gText(x0, y0, "LCD_screen Library Suite");
     y0 += fontSizeY()+1;
     setFontSize(1);
-    gText(x0, y0, "release " + String(LCD_SCREEN_RELEASE/100) + "." + String(LCD_SCREEN_RELEASE/10%10) + String(LCD_SCREEN_RELEASE%10));
+    gText(x0, y0, release);
     y0 += fontSizeY()+1;
     gText(x0, y0, "(c) Rei Vilo, 2013");
     y0 += fontSizeY()+1;
     setFontSize(0);
     gText(x0, y0, "reivilofischertechnik.weebly.com");
     y0 += fontSizeY()+1;
-    gText(x0, y0, "Screen:   " + WhoAmI());
+    // Values after a 10-character label
+    x1 = x0 + 10*fontSizeX();
+    gText(x0, y0, "Screen:");
+    gText(x1, y0, WhoAmI());
     y0 += fontSizeY()+1;
-    gText(x0, y0, "Pixels:   " + String(screenSizeX()) + " x " + String(screenSizeY()));
+    gText(x0, y0, "Pixels:");
+    gText(x1, y0, _decimal(buffer, sizeof(buffer), screenSizeX()));
+    gText(x1 + 4*fontSizeX(), y0, "x");
+    gText(x1 + 6*fontSizeX(), y0, _decimal(buffer, sizeof(buffer), screenSizeY()));
     y0 += fontSizeY()+1;
-    gText(x0, y0, "Readable: " + String((isReadable()) ? "yes" : "no"));
+    gText(x0, y0, "Readable:");
+    gText(x1, y0, (isReadable()) ? "yes" : "no");
     y0 += fontSizeY()+1;
-    gText(x0, y0, "Touch:    " + String((isTouch()) ? "yes" : "no"));
+    gText(x0, y0, "Touch:");
+    gText(x1, y0, (isTouch()) ? "yes" : "no");
     y0 += fontSizeY()+1;
-    gText(x0, y0, "Storage:  " + String((isStorage()) ? "yes" : "no"));
+    gText(x0, y0, "Storage:");
+    gText(x1, y0, (isStorage()) ? "yes" : "no");
     y0 += fontSizeY()+1;
 }
+void LCD_screen::gText(uint16_t x0, uint16_t y0,
+                       const char *s,
+                       uint16_t textColour, uint16_t backColour,
+                       uint8_t ix, uint8_t iy)
+{
+    _gText(x0, y0, s, strlen(s), textColour, backColour, ix, iy);
+}
+// Flash and RAM share the address space on MSP430, MSP432 and Tiva
+void LCD_screen::gText(uint16_t x0, uint16_t y0,
+                       const __FlashStringHelper *s,
+                       uint16_t textColour, uint16_t backColour,
+                       uint8_t ix, uint8_t iy)
+{
+    const char *p = reinterpret_cast<const char *>(s);
+    _gText(x0, y0, p, strlen(p), textColour, backColour, ix, iy);
+}
+void LCD_screen::gText(uint16_t x0, uint16_t y0,
+                       const String &s,
+                       uint16_t textColour, uint16_t backColour,
+                       uint8_t ix, uint8_t iy)
+{
+    _gText(x0, y0, s.c_str(), s.length(), textColour, backColour, ix, iy);
+}
+void LCD_screen::gTextLength(uint16_t x0, uint16_t y0,
+                             const char *s, uint16_t length,
+                             uint16_t textColour, uint16_t backColour,
+                             uint8_t ix, uint8_t iy)
+{
+    _gText(x0, y0, s, length, textColour, backColour, ix, iy);
+}
 void LCD_screen::clear(uint16_t colour)
 {
     uint8_t oldOrientation = _orientation;
@@ -190,10 +248,34 @@ void LCD_screen::setPenSolid(bool flag)
 {
     _penSolid = flag;
 }
+bool LCD_screen::isPenSolid()
+{
+    return _penSolid;
+}
 void LCD_screen::point(uint16_t x1, uint16_t y1, uint16_t colour)
 {
     _setPoint(x1, y1, colour);
 }
+// Windowed burst: open a window, then stream colours in GRAM auto-increment order
+void LCD_screen::setWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    if (x1 > x2) _swap(x1, x2);
+    if (y1 > y2) _swap(y1, y2);
+    _setWindow(x1, y1, x2, y2);
+}
+void LCD_screen::writeColour(uint16_t colour, uint32_t count)
+{
+    uint8_t highColour = highByte(colour);
+    uint8_t lowColour  = lowByte(colour);
+    for (; count>0; count--) _writeData88(highColour, lowColour);
+}
+void LCD_screen::writeColours(const uint16_t *colours, uint16_t count)
+{
+    for (; count>0; count--) {
+        _writeData88(highByte(*colours), lowByte(*colours));
+        colours++;
+    }
+}
 void LCD_screen::rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
 {
     if (_penSolid == false) {
@@ -323,6 +405,10 @@ void LCD_screen::setFontSolid(bool flag)
 {
     _fontSolid = flag;
 }
+bool LCD_screen::isFontSolid()
+{
+    return _fontSolid;
+}
 uint16_t LCD_screen::calculateColour(uint8_t red, uint8_t green, uint8_t blue)
 {
     return (red >> 3) << 11 | (green >> 2) << 5 | (blue >> 3);
@@ -340,14 +426,8 @@ uint16_t LCD_screen::halveColour(uint16_t rgb) {
 }
 uint16_t LCD_screen::averageColour(uint16_t rgb1, uint16_t rgb2)
 {
-    uint8_t r1, g1, b1, r2, g2, b2;
-    uint16_t r, g, b;
-    splitColour(rgb1, r1, g1, b1);
-    splitColour(rgb2, r2, g2, b2);
-    r = (uint16_t)(r1 + r2)/2;
-    g = (uint16_t)(g1 + g2)/2;
-    b = (uint16_t)(b1 + b2)/2;
-    return calculateColour((uint8_t)r, (uint8_t)g, (uint8_t)b);
+    // Same result as averaging channel by channel, see LCD_colour.h
+    return (rgb1 & rgb2) + (((rgb1 ^ rgb2) & 0b1111011111011110) >> 1);
 }
 uint16_t LCD_screen::reverseColour(uint16_t rgb) {
     return (uint16_t)(rgb ^ 0b1111111111111111);
@@ -371,6 +451,11 @@ uint16_t LCD_screen::readPixel(uint16_t x1, uint16_t y1)
 void LCD_screen::copyPaste(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t dx, uint16_t dy)
 {
 }
+// No hardware scroll by default
+bool LCD_screen::setScroll(uint16_t offset, bool vertical)
+{
+    return false;
+}
 void LCD_screen::copyArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint32_t &address)
 {
 }
@@ -391,36 +476,119 @@ bool LCD_screen::getTouch(uint16_t &x, uint16_t &y, uint16_t &z)
     _getRawTouch(x0, y0, z0);
     z = z0;
     if (z > _touchTrim) {
-        x0 = _check(x0, _touchXmin, _touchXmax);
-        y0 = _check(y0, _touchYmin, _touchYmax);
+        mapTouch(x0, y0, x, y);
+        return true;
+    } else {
+        return false;
+    }
+}
+// Raw coordinates to screen coordinates: two multiply-adds with the calibration of the orientation
+void LCD_screen::mapTouch(uint16_t x0, uint16_t y0, uint16_t &x, uint16_t &y)
+{
+    if (_touchOrientation != _orientation) {
+        // Orientation 0 rows, mirrored or swapped, with the rounding in the constants
+        int32_t width  = (int32_t)(_screenWidth - 1) << 16;
+        int32_t height = (int32_t)(_screenHeigth - 1) << 16;
+        const LCD_touchCalibration &c = _touchCalibration;
+        int32_t *m = _touchMatrix;
         switch (_orientation) {
             case 0:
-                x = map(x0, _touchXmin, _touchXmax, 0, _screenWidth);
-                y = map(y0, _touchYmin, _touchYmax, 0, _screenHeigth);
+                m[0] = c.a;  m[1] = c.b;  m[2] = c.c;
+                m[3] = c.d;  m[4] = c.e;  m[5] = c.f;
                 break;
             case 1:
-                x = map(y0, _touchYmin, _touchYmax, 0, _screenHeigth);
-                y = map(x0, _touchXmin, _touchXmax, _screenWidth, 0);
+                m[0] = c.d;  m[1] = c.e;  m[2] = c.f;
+                m[3] = -c.a; m[4] = -c.b; m[5] = width - c.c;
                 break;
             case 2:
-                x = map(x0, _touchXmin, _touchXmax, _screenWidth, 0);
-                y = map(y0, _touchYmin, _touchYmax, _screenHeigth, 0);
+                m[0] = -c.a; m[1] = -c.b; m[2] = width - c.c;
+                m[3] = -c.d; m[4] = -c.e; m[5] = height - c.f;
                 break;
             case 3:
-                x = map(y0, _touchYmin, _touchYmax, _screenHeigth, 0);
-                y = map(x0, _touchXmin, _touchXmax, 0, _screenWidth);
+                m[0] = -c.d; m[1] = -c.e; m[2] = height - c.f;
+                m[3] = c.a;  m[4] = c.b;  m[5] = c.c;
                 break;
         }
-        return true;
-    } else {
-        return false;
+        m[2] += 0x8000;
+        m[5] += 0x8000;
+        _touchOrientation = _orientation;
+    }
+
+    int32_t xs = (_touchMatrix[0] * x0 + _touchMatrix[1] * y0 + _touchMatrix[2]) >> 16;
+    int32_t ys = (_touchMatrix[3] * x0 + _touchMatrix[4] * y0 + _touchMatrix[5]) >> 16;
+    x = constrain(xs, 0, (int32_t)screenSizeX() - 1);
+    y = constrain(ys, 0, (int32_t)screenSizeY() - 1);
+}
+// Q16 quotient, rounded to nearest
+static int32_t _divideQ16(int32_t numerator, int32_t denominator)
+{
+    int64_t n = (int64_t)numerator << 16;
+    if ((n < 0) != (denominator < 0)) n -= denominator / 2;
+    else n += denominator / 2;
+    return (int32_t)(n / denominator);
+}
+bool LCD_screen::setTouchCalibration(const uint16_t x[3], const uint16_t y[3], const uint16_t x0[3], const uint16_t y0[3])
+{
+    // Differences to the third point, solved by Cramer's rule
+    int32_t dx0 = (int32_t)x0[0] - x0[2], dy0 = (int32_t)y0[0] - y0[2];
+    int32_t dx1 = (int32_t)x0[1] - x0[2], dy1 = (int32_t)y0[1] - y0[2];
+    int32_t sx0 = (int32_t)x[0] - x[2], sy0 = (int32_t)y[0] - y[2];
+    int32_t sx1 = (int32_t)x[1] - x[2], sy1 = (int32_t)y[1] - y[2];
+    int32_t determinant = dx0 * dy1 - dx1 * dy0;
+    if (determinant == 0) return false;
+
+    LCD_touchCalibration c;
+    c.a = _divideQ16(sx0 * dy1 - sx1 * dy0, determinant);
+    c.b = _divideQ16(dx0 * sx1 - dx1 * sx0, determinant);
+    c.d = _divideQ16(sy0 * dy1 - sy1 * dy0, determinant);
+    c.e = _divideQ16(dx0 * sy1 - dx1 * sy0, determinant);
+
+    // Constants averaged over the 3 points
+    int64_t sumX = 0, sumY = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+        sumX += ((int64_t)x[i] << 16) - (int64_t)c.a * x0[i] - (int64_t)c.b * y0[i];
+        sumY += ((int64_t)y[i] << 16) - (int64_t)c.d * x0[i] - (int64_t)c.e * y0[i];
     }
+    c.c = (int32_t)(sumX / 3);
+    c.f = (int32_t)(sumY / 3);
+    setTouchCalibration(c);
+    return true;
+}
+void LCD_screen::setTouchCalibration(const LCD_touchCalibration &calibration)
+{
+    _touchCalibration = calibration;
+    _touchOrientation = 0xFF;
+}
+void LCD_screen::getTouchCalibration(LCD_touchCalibration &calibration)
+{
+    calibration = _touchCalibration;
+}
+// Calibration from the raw range of each axis, without rotation
+void LCD_screen::_setTouchRange(uint16_t xmin, uint16_t xmax, uint16_t ymin, uint16_t ymax)
+{
+    LCD_touchCalibration c;
+    c.a = ((int32_t)_screenWidth << 16) / ((int32_t)xmax - xmin);
+    c.b = 0;
+    c.c = -c.a * xmin;
+    c.d = 0;
+    c.e = ((int32_t)_screenHeigth << 16) / ((int32_t)ymax - ymin);
+    c.f = -c.e * ymin;
+    setTouchCalibration(c);
+}
+uint8_t LCD_screen::touchTrim()
+{
+    return _touchTrim;
+}
+// Screens without a non-blocking sampler take a full reading
+bool LCD_screen::pollRawTouch(uint16_t &x0, uint16_t &y0, uint16_t &z0)
+{
+    _getRawTouch(x0, y0, z0);
+    return true;
 }
 void LCD_screen::calibrateTouch()
 {
     if (_touchTrim == 0) return;
-    uint16_t x00, y00, x10, x01, x11, y10, y01, y11, z0;
-    uint16_t x0, x1, y0, y1;
+    uint16_t x[3], y[3], x0[3], y0[3];
     uint8_t  old = _orientation;
     setOrientation(0);
     clear();
@@ -428,49 +596,51 @@ void LCD_screen::calibrateTouch()
     gText(screenSizeX()/2-17*fontSizeX()/2, screenSizeY()/2-fontSizeY(), "TOUCH CALIBRATION", redColour, blackColour);
     gText(screenSizeX()/2-16*fontSizeX()/2, screenSizeY()/2,             "Press the centre", redColour, blackColour);
     gText(screenSizeX()/2-17*fontSizeX()/2, screenSizeY()/2+fontSizeY(), "of the red circle", redColour, blackColour);
-    _displayTarget(10, 10, redColour);
-    z0 = 0;
-    do _getRawTouch(x00, y00, z0); while (z0<_touchTrim);
-    _displayTarget(10, 10, greenColour);
-    delay(500);
-    _displayTarget(_screenWidth-10, 10, redColour);
-    z0 = 0;
-    do _getRawTouch(x10, y10, z0); while (z0<_touchTrim);
-    _displayTarget(_screenWidth-10, 10, greenColour);
-    delay(500);
-    _displayTarget(_screenWidth-10, _screenHeigth-10, redColour);
-    z0 = 0;
-    do _getRawTouch(x11, y11, z0); while (z0<_touchTrim);
-    _displayTarget(_screenWidth-10, _screenHeigth-10, greenColour);
-    delay(500);
-    _displayTarget(10, _screenHeigth-10, redColour);
-    z0 = 0;
-    do _getRawTouch(x01, y01, z0); while (z0<_touchTrim);
-    _displayTarget(10, _screenHeigth-10, greenColour);
-    x0 = (x00+x01)/2;
-    x1 = (x10+x11)/2;
-    y0 = (y00+y10)/2;
-    y1 = (y01+y11)/2;
-    _touchXmin = x0 - 10 * (x1-x0) / (_screenWidth -10-10);
-    _touchXmax = x1 + 10 * (x1-x0) / (_screenWidth -10-10);
-    _touchYmin = y0 - 10 * (y1-y0) / (_screenHeigth-10-10);
-    _touchYmax = y1 + 10 * (y1-y0) / (_screenHeigth-10-10);
-    Serial.println("touch calibration");
-    Serial.print("_touchXmin =");
-    Serial.print(_touchXmin, DEC);
-    Serial.println(";");
-    Serial.print("_touchXmax =");
-    Serial.print(_touchXmax, DEC);
-    Serial.println(";");
-    Serial.print("_touchYmin =");
-    Serial.print(_touchYmin, DEC);
-    Serial.println(";");
-    Serial.print("_touchYmax =");
-    Serial.print(_touchYmax, DEC);
-    Serial.println(";");
+    // Three targets far apart and not aligned
+    x[0] = _screenWidth/8;   y[0] = _screenHeigth/8;
+    x[1] = _screenWidth*7/8; y[1] = _screenHeigth/2;
+    x[2] = _screenWidth/2;   y[2] = _screenHeigth*7/8;
+    for (uint8_t i = 0; i < 3; i++) _readTarget(x[i], y[i], x0[i], y0[i]);
+    if (setTouchCalibration(x, y, x0, y0)) {
+        Serial.println("touch calibration");
+        Serial.print("LCD_touchCalibration calibration = {");
+        Serial.print(_touchCalibration.a, DEC);
+        Serial.print(", ");
+        Serial.print(_touchCalibration.b, DEC);
+        Serial.print(", ");
+        Serial.print(_touchCalibration.c, DEC);
+        Serial.print(", ");
+        Serial.print(_touchCalibration.d, DEC);
+        Serial.print(", ");
+        Serial.print(_touchCalibration.e, DEC);
+        Serial.print(", ");
+        Serial.print(_touchCalibration.f, DEC);
+        Serial.println("};");
+    }
     clear();
     setOrientation(old);
 }
+// Raw position of a target, averaged over 8 samples, then wait for the release
+void LCD_screen::_readTarget(uint16_t x0, uint16_t y0, uint16_t &x, uint16_t &y)
+{
+    uint16_t x1, y1, z1;
+    uint32_t sumX = 0, sumY = 0;
+    uint8_t  count = 0;
+
+    _displayTarget(x0, y0, redColour);
+    while (count < 8) {
+        _getRawTouch(x1, y1, z1);
+        if (z1 < _touchTrim) continue;
+        sumX += x1;
+        sumY += y1;
+        count++;
+    }
+    x = sumX / 8;
+    y = sumY / 8;
+    _displayTarget(x0, y0, greenColour);
+    do _getRawTouch(x1, y1, z1); while (z1 >= _touchTrim);
+    delay(500);
+}
 void LCD_screen::_swap(uint16_t &a, uint16_t &b)
 {
     uint16_t w = a;
@@ -39,11 +39,16 @@ const uint16_t magentaColour  = 0b1111100000001111;
 const uint16_t violetColour   = 0b1111100000011111;
 const uint16_t grayColour     = 0b0111101111101111;
 const uint16_t darkGrayColour = 0b0011100111100111;
+// Touch calibration, raw values to coordinates in orientation 0, Q16:
+// x = (a * x0 + b * y0 + c) / 65536, y = (d * x0 + e * y0 + f) / 65536
+struct LCD_touchCalibration {
+    int32_t a, b, c, d, e, f;
+};
 class LCD_screen {
 public:
     LCD_screen();
     virtual void begin() =0;
-    virtual String WhoAmI() =0;
+    virtual const char *WhoAmI() =0;
     void clear(uint16_t colour = blackColour);
     virtual void setOrientation(uint8_t orientation);
     uint8_t getOrientation();
@@ -55,18 +60,35 @@ public:
     virtual void line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
     virtual void dLine(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour);
     virtual void setPenSolid(bool flag = true);
+    bool isPenSolid();
     virtual void triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour);
     virtual void rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
     virtual void dRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour);
     virtual void point(uint16_t x1, uint16_t y1, uint16_t colour);
+    void setWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+    void writeColour(uint16_t colour, uint32_t count = 1);
+    void writeColours(const uint16_t *colours, uint16_t count);
     virtual void setFontSize(uint8_t size) =0;
     virtual void setFontSolid(bool flag = true);
+    bool isFontSolid();
     virtual uint8_t fontSizeX() =0;
     virtual uint8_t fontSizeY() =0;
-    virtual void gText(uint16_t x0, uint16_t y0,
-                       String s,
-                       uint16_t textColour = whiteColour, uint16_t backColour = blackColour,
-                       uint8_t ix = 1, uint8_t iy = 1) =0;
+    void gText(uint16_t x0, uint16_t y0,
+               const char *s,
+               uint16_t textColour = whiteColour, uint16_t backColour = blackColour,
+               uint8_t ix = 1, uint8_t iy = 1);
+    void gText(uint16_t x0, uint16_t y0,
+               const __FlashStringHelper *s,
+               uint16_t textColour = whiteColour, uint16_t backColour = blackColour,
+               uint8_t ix = 1, uint8_t iy = 1);
+    void gText(uint16_t x0, uint16_t y0,
+               const String &s,
+               uint16_t textColour = whiteColour, uint16_t backColour = blackColour,
+               uint8_t ix = 1, uint8_t iy = 1);
+    void gTextLength(uint16_t x0, uint16_t y0,
+                     const char *s, uint16_t length,
+                     uint16_t textColour = whiteColour, uint16_t backColour = blackColour,
+                     uint8_t ix = 1, uint8_t iy = 1);
     uint16_t calculateColour(uint8_t red, uint8_t green, uint8_t blue);
     void splitColour(uint16_t rgb, uint8_t &red, uint8_t &green, uint8_t &blue);
     uint16_t halveColour(uint16_t rgb);
@@ -78,22 +100,38 @@ public:
     virtual void copyPaste(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t dx, uint16_t dy);
     virtual void copyArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint32_t &address);
     virtual void pasteArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint32_t &address, bool option=false);
+    virtual bool setScroll(uint16_t offset, bool vertical = true);
     bool isTouch();
     bool getTouch(uint16_t &x, uint16_t &y, uint16_t &z);
+    void mapTouch(uint16_t x0, uint16_t y0, uint16_t &x, uint16_t &y);
+    uint8_t touchTrim();
     void calibrateTouch();
+    // Calibration from 3 points in orientation 0, screen x, y and raw x0, y0, false if degenerate
+    bool setTouchCalibration(const uint16_t x[3], const uint16_t y[3], const uint16_t x0[3], const uint16_t y0[3]);
+    void setTouchCalibration(const LCD_touchCalibration &calibration);
+    void getTouchCalibration(LCD_touchCalibration &calibration);
+    // One step of the touch sampler, true when a new raw sample is returned
+    virtual bool pollRawTouch(uint16_t &x0, uint16_t &y0, uint16_t &z0);
 protected:
     uint8_t      _fontX, _fontY, _fontSize;
     uint8_t      _orientation;
     bool         _penSolid, _fontSolid, _flagRead, _flagStorage;
     uint16_t     _screenWidth, _screenHeigth;
     uint8_t      _touchTrim;
-    uint16_t     _touchXmin, _touchXmax, _touchYmin, _touchYmax;
+    LCD_touchCalibration _touchCalibration;
+    // Calibration with the orientation folded in, for _touchOrientation
+    int32_t      _touchMatrix[6];
+    uint8_t      _touchOrientation;
     virtual void _fastFill(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour) =0;
     virtual void _setPoint(uint16_t x1, uint16_t y1, uint16_t colour) =0;
     virtual void _getRawTouch(uint16_t &x0, uint16_t &y0, uint16_t &z0) =0;
     virtual void _setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) =0;
     virtual void _writeData88(uint8_t dataHigh8, uint8_t dataLow8) =0;
+    virtual void _gText(uint16_t x0, uint16_t y0, const char *s, uint16_t length,
+                        uint16_t textColour, uint16_t backColour, uint8_t ix, uint8_t iy) =0;
     void         _displayTarget(uint16_t x0, uint16_t y0, uint16_t colour);
+    void         _readTarget(uint16_t x0, uint16_t y0, uint16_t &x, uint16_t &y);
+    void         _setTouchRange(uint16_t xmin, uint16_t xmax, uint16_t ymin, uint16_t ymax);
     void         _swap(int16_t &a, int16_t &b);
     void         _swap(uint16_t &a, uint16_t &b);
     void         _swap(uint8_t &a, uint8_t &b);
@@ -18,15 +18,38 @@
 //
 // Library header
 #include "LCD_screen_font.h"
+
+// Glyphs of solid text decoded at once, and sent through one window
+#define FONT_CACHE 16
+
 LCD_screen_font::LCD_screen_font()
 {
-    ;
+    _font = &Terminal6x8c;
+    _cursorX = _cursorY = _cursorX0 = 0;
+    _cursorTextColour = whiteColour;
+    _cursorBackColour = blackColour;
+    _utf8Count = 0;
 }
 
 void LCD_screen_font::setFontSize(uint8_t size)
 {
     if (size < MAX_FONT_SIZE) _fontSize = size;
     else _fontSize = MAX_FONT_SIZE -1;
+
+    if (_fontSize == 0) _font = &Terminal6x8c;
+    else if (_fontSize == 1) _font = &Terminal8x12c;
+    else if (_fontSize == 2) _font = &Terminal12x16c;
+    else _font = &Terminal16x24c;
+}
+
+void LCD_screen_font::setFont(const LCD_font *font)
+{
+    _font = font;
+}
+
+const LCD_font *LCD_screen_font::getFont()
+{
+    return _font;
 }
 
 uint8_t LCD_screen_font::fontMax()
@@ -36,280 +59,422 @@ uint8_t LCD_screen_font::fontMax()
 
 uint8_t LCD_screen_font::fontSizeX()
 {
-#if (MAX_FONT_SIZE > 0)
-    if (_fontSize == 0) return 6;
-#if (MAX_FONT_SIZE > 1)
-    else if (_fontSize == 1) return 8;
-#if (MAX_FONT_SIZE > 2)
-    else if (_fontSize == 2) return 12;
-#if (MAX_FONT_SIZE > 3)
-    else if (_fontSize == 3) return 16;
-#endif
-#endif
-#endif
-#endif
-    else return 0;
+    return _font->width;
 }
 
 uint8_t LCD_screen_font::fontSizeY()
 {
-#if (MAX_FONT_SIZE > 0)
-    if (_fontSize == 0) return 8;
-#if (MAX_FONT_SIZE > 1)
-    else if (_fontSize == 1) return 12;
-#if (MAX_FONT_SIZE > 2)
-    else if (_fontSize == 2) return 16;
-#if (MAX_FONT_SIZE > 3)
-    else if (_fontSize == 3) return 24;
-#endif
-#endif
-#endif
-#endif
-    else return 0;
+    return _font->height;
+}
+
+// Box of character c, height 0 when blank or not in the font, see LCD_font.h
+void LCD_screen_font::_getGlyph(uint8_t c, LCD_glyph &glyph)
+{
+    const uint8_t *record;
+
+    // Blank or outside the font: an empty box
+    glyph.bits = NULL;
+    glyph.left = glyph.width = glyph.top = glyph.height = 0;
+    if ((c < _font->first) || (c > _font->last)) return;
+    c -= _font->first;
+
+    if (_font->bases == NULL) {
+        // Whole cell
+        glyph.bits = _font->data + c * ((_font->width * _font->height + 7) >> 3);
+        glyph.left = glyph.top = 0;
+        glyph.width = _font->width;
+        glyph.height = _font->height;
+        return;
+    }
+
+    uint16_t start = _font->bases[c >> _font->block] + _font->offsets[c];
+    if (start == _font->bases[(c+1) >> _font->block] + _font->offsets[c+1]) return;
+    record = _font->data + start;
+
+    glyph.left = record[0] >> 4;
+    glyph.width = (record[0] & 0x0F) + 1;
+    if (_font->height > LCD_FONT_SHORT) {
+        glyph.top = record[1];
+        glyph.height = record[2];
+        glyph.bits = record + 3;
+    } else {
+        glyph.top = record[1] >> 4;
+        glyph.height = (record[1] & 0x0F) + 1;
+        glyph.bits = record + 2;
+    }
+}
+
+// Row j of a glyph, LSB = leftmost column
+uint16_t LCD_screen_font::_getGlyphRow(const LCD_glyph &glyph, uint8_t j)
+{
+    if ((j < glyph.top) || (j >= glyph.top + glyph.height)) return 0;
+
+    uint8_t width = glyph.width;
+    uint16_t offset = (j - glyph.top) * width;
+    const uint8_t *data = glyph.bits + (offset >> 3);
+    uint8_t shift = offset & 0x07;
+    uint32_t bits = data[0];
+
+    // Only the bytes the row spans are read, a record may end with the row
+    if (shift + width > 8) bits |= (uint16_t)data[1] << 8;
+    if (shift + width > 16) bits |= (uint32_t)data[2] << 16;
+    bits = (bits >> shift) & (((uint32_t)1 << width) - 1);
+    return (uint16_t)bits << glyph.left;
 }
 
-uint8_t LCD_screen_font::_getCharacter(uint8_t c, uint8_t i) {
-#if (MAX_FONT_SIZE > 0)
-    if (_fontSize == 0) return Terminal6x8e[c][i];
-#if (MAX_FONT_SIZE > 1)
-    else if (_fontSize == 1) return Terminal8x12e[c][i];
-#if (MAX_FONT_SIZE > 2)
-    else if (_fontSize == 2) return Terminal12x16e[c][i];
-#if (MAX_FONT_SIZE > 3)
-    else if (_fontSize == 3) return Terminal16x24e[c][i];
-#endif
-#endif
-#endif
-#endif
-#if (MAX_FONT_SIZE > 0)
-    if (_fontSize == 0) return pgm_read_byte(&Terminal6x8e[c][i]);
-#if (MAX_FONT_SIZE > 1)
-    else if (_fontSize == 1) return pgm_read_byte(&Terminal8x12e[c][i]);
-#if (MAX_FONT_SIZE > 2)
-    else if (_fontSize == 2) return pgm_read_byte(&Terminal12x16e[c][i]);
-#if (MAX_FONT_SIZE > 3)
-    else if (_fontSize == 3) return pgm_read_byte(&Terminal16x24e[c][i]);
-#endif
-#endif
-#endif
-#endif
+// Advance of character c, the cell width for fixed-cell fonts and characters outside the font
+uint8_t LCD_screen_font::_getAdvance(uint8_t c)
+{
+    if ((_font->advances == NULL) || (c < _font->first) || (c > _font->last)) return _font->width;
+    return _font->advances[c - _font->first];
 }
 
-void LCD_screen_font::gText(uint16_t x0, uint16_t y0,
-                            String s,
-                            uint16_t textColour, uint16_t backColour,
-                            uint8_t ix, uint8_t iy)
+// Width of length bytes of UTF-8 text, unscaled
+uint16_t LCD_screen_font::_textWidth(const char *s, uint16_t length)
 {
+    uint16_t width = 0;
+    uint16_t k = 0;
+
+    while (k < length) width += _getAdvance(utf8Next(s, length, &k));
+    return width;
+}
+
+uint16_t LCD_screen_font::textWidth(const char *s, uint8_t ix)
+{
+    return _textWidth(s, strlen(s)) * ix;
+}
+
+uint16_t LCD_screen_font::textWidth(const String &s, uint8_t ix)
+{
+    return textWidth(s.c_str(), ix);
+}
+
+uint16_t LCD_screen_font::textFit(const char *s, uint16_t dx, uint16_t &width, uint8_t ix)
+{
+    uint16_t length = strlen(s);
+    uint16_t k = 0, fit = 0;
+
+    width = 0;
+    while (k < length) {
+        uint16_t advance = _getAdvance(utf8Next(s, length, &k)) * ix;
+        if (width + advance > dx) break;
+        width += advance;
+        fit = k;
+    }
+    return fit;
+}
+
+// Text field drawn over the previous string, kept by the caller in previous[size]
+// Characters are compared once decoded, a UTF-8 sequence takes one cell.
+// Fixed-cell fonts: only the runs of changed characters are drawn, single unchanged
+// characters inside a run are drawn again rather than opening a new window.
+// Proportional fonts: the string is drawn again from the first change.
+// The field is always drawn solid, the background covers what the previous string left.
+// A string longer than size - 1 bytes is cut there, so the screen matches previous.
+void LCD_screen_font::gTextUpdate(uint16_t x0, uint16_t y0,
+                                  const char *s, char *previous, uint8_t size,
+                                  uint16_t textColour, uint16_t backColour,
+                                  uint8_t ix, uint8_t iy)
+{
+    if (size == 0) return;
+
+    uint16_t length = strlen(s);
+    uint16_t oldLength = strlen(previous);
+    uint16_t x, xOld;
+    uint16_t k, p, next, nextOld;
     uint8_t c;
-    uint8_t line, line1, line2, line3;
-    uint16_t x, y;
-    uint8_t i, j, k;
-    if ((ix > 1) || (iy > 1) || !_fontSolid) {
-        if ((_fontSize == 0) && ((ix > 1) || (iy > 1))) {
-            bool oldPenSolid = _penSolid;
-            setPenSolid(true);
-            for (k=0; k<s.length(); k++) {
-                x = x0 + 6 * k * ix;
-                y = y0;
-                c = s.charAt(k)-' ';
-                for ( i=0; i<6; i++ ) {
-                    line = _getCharacter(c, i);
-                    for ( j = 0; j<8; j++) {
-                        if (bitRead(line, j)) rectangle(x+i*ix, y+j*iy, x+i*ix+ix-1, y+j*iy+iy-1, textColour);
-                        else if (_fontSolid)  rectangle(x+i*ix, y+j*iy, x+i*ix+ix-1, y+j*iy+iy-1, backColour);
-                    }
+    bool flagSolid = _fontSolid;
+
+    // Only what previous can keep is drawn, without cutting a UTF-8 sequence
+    if (length > size - 1) {
+        length = size - 1;
+        while ((length > 0) && (((uint8_t)s[length] & 0xC0) == 0x80)) length--;
+    }
+
+    _fontSolid = true;
+    k = p = 0;
+    if (_font->advances == NULL) {
+        uint16_t cell = _font->width * ix;
+        uint16_t column = 0;
+        uint16_t start = 0, end = 0, startColumn = 0;
+        uint8_t gap = 0;
+        bool run = false;
+
+        while (k < length) {
+            next = k;
+            c = utf8Next(s, length, &next);
+            if ((p < oldLength) && (utf8Next(previous, oldLength, &p) == c)) {
+                // Unchanged, one is bridged inside a run
+                if (run && (++gap > 1)) {
+                    _gText(x0 + startColumn * cell, y0, s + start, end - start, textColour, backColour, ix, iy);
+                    run = false;
                 }
-            }
-            setPenSolid(oldPenSolid);
-        } else {
-#if (MAX_FONT_SIZE > 0)
-            if (_fontSize == 0) {
-                for (k=0; k<s.length(); k++) {
-                    c = s.charAt(k)-' ';
-                    for (i=0; i<6; i++) {
-                        line = _getCharacter(c, i);
-                        for (j=0; j<8; j++)
-                            if (bitRead(line, j)) point(x0 + 6*k + i, y0 + j, textColour);
-                            else if (_fontSolid)  point(x0 + 6*k + i, y0 + j, backColour);
-                    }
+            } else {
+                if (!run) {
+                    start = k;
+                    startColumn = column;
+                    run = true;
                 }
+                end = next;
+                gap = 0;
             }
-#if (MAX_FONT_SIZE > 1)
-            else if (_fontSize == 1) {
-                for (k=0; k<s.length(); k++) {
-                    c = s.charAt(k)-' ';
-                    for (i=0; i<8; i++) {
-                        line = _getCharacter(c, 2*i);
-                        line1 =_getCharacter(c, 2*i+1);
-                        for (j=0; j<8; j++) {
-                            if (bitRead(line, j)) point(x0 + 8*k + i, y0 + j, textColour);
-                            else if (_fontSolid)  point(x0 + 8*k + i, y0 + j, backColour);
-                            if (bitRead(line1, j))  point(x0 + 8*k + i, y0 +8 + j, textColour);
-                            else if ((_fontSolid) && (j<4)) point(x0 + 8*k + i, y0 +8 + j, backColour);
-                        }
-                    }
-                }
+            k = next;
+            column++;
+        }
+        if (run) _gText(x0 + startColumn * cell, y0, s + start, end - start, textColour, backColour, ix, iy);
+        x = x0 + column * cell;
+        while (p < oldLength) {
+            utf8Next(previous, oldLength, &p);
+            column++;
+        }
+        xOld = x0 + column * cell;
+    } else {
+        // Common start
+        x = x0;
+        while ((k < length) && (p < oldLength)) {
+            next = k;
+            c = utf8Next(s, length, &next);
+            nextOld = p;
+            if (utf8Next(previous, oldLength, &nextOld) != c) break;
+            x += _getAdvance(c) * ix;
+            k = next;
+            p = nextOld;
+        }
+        xOld = x + _textWidth(previous + p, oldLength - p) * ix;
+        if (k < length) _gText(x, y0, s + k, length - k, textColour, backColour, ix, iy);
+        x += _textWidth(s + k, length - k) * ix;
+    }
+    _fontSolid = flagSolid;
+
+    // Background over the end of a longer previous string
+    if (xOld > screenSizeX()) xOld = screenSizeX();
+    if (xOld > x) _fastFill(x, y0, xOld - 1, y0 + _font->height * iy - 1, backColour);
+
+    // Kept for the next update
+    memcpy(previous, s, length);
+    previous[length] = '\0';
+}
+
+void LCD_screen_font::setCursor(uint16_t x0, uint16_t y0)
+{
+    _cursorX = _cursorX0 = x0;
+    _cursorY = y0;
+}
+
+uint16_t LCD_screen_font::getCursorX()
+{
+    return _cursorX;
+}
+
+uint16_t LCD_screen_font::getCursorY()
+{
+    return _cursorY;
+}
+
+void LCD_screen_font::setTextColour(uint16_t textColour, uint16_t backColour)
+{
+    _cursorTextColour = textColour;
+    _cursorBackColour = backColour;
+}
+
+size_t LCD_screen_font::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+// Print sink: the buffer is UTF-8, a sequence split between two writes is kept
+// in _utf8 until its last byte arrives, as print() of single bytes does.
+size_t LCD_screen_font::write(const uint8_t *buffer, size_t size)
+{
+    const char *s = (const char *)buffer;
+    size_t k = 0;
+    size_t end = size;
+
+    if (_utf8Count > 0) {
+        while ((k < size) && (_utf8Count < utf8Length(_utf8[0])) && ((buffer[k] & 0xC0) == 0x80)) {
+            _utf8[_utf8Count++] = buffer[k++];
+        }
+        if ((k == size) && (_utf8Count < utf8Length(_utf8[0]))) return size;
+        _writeText(_utf8, _utf8Count);
+        _utf8Count = 0;
+    }
+
+    // Sequence cut at the end of the buffer
+    for (size_t j = size; (j > k) && (size - j < 3); ) {
+        j--;
+        if ((buffer[j] & 0xC0) != 0x80) {
+            if (utf8Length(buffer[j]) > size - j) {
+                _utf8Count = size - j;
+                memcpy(_utf8, s + j, _utf8Count);
+                end = j;
             }
-#if (MAX_FONT_SIZE > 2)
-            else if (_fontSize == 2) {
-                for (k=0; k<s.length(); k++) {
-                    c = s.charAt(k)-' ';
-                    for (i=0; i<12; i++) {
-                        line = _getCharacter(c, 2*i);
-                        line1 =_getCharacter(c, 2*i+1);
-                        for (j=0; j<8; j++) {
-                            if (bitRead(line, j))  point(x0 + 12*k + i, y0 + j,    textColour);
-                            else if (_fontSolid)   point(x0 + 12*k + i, y0 + j,    backColour);
-                            if (bitRead(line1, j)) point(x0 + 12*k + i, y0 +8 + j, textColour);
-                            else if (_fontSolid)   point(x0 + 12*k + i, y0 +8 + j, backColour);
-                        }
-                    }
-                }
+            break;
+        }
+    }
+
+    _writeText(s + k, end - k);
+    return size;
+}
+
+// Printable characters are drawn in runs, one gText per run
+// '\n' moves to the start of the next line, '\r' is ignored, long lines wrap
+// and the text restarts at the top of the screen after the last line.
+void LCD_screen_font::_writeText(const char *s, uint16_t length)
+{
+    uint16_t start = 0;
+    uint16_t width = 0;
+    uint16_t k = 0, next;
+    uint8_t advance, c;
+
+    while (k < length) {
+        next = k;
+        c = utf8Next(s, length, &next);
+        advance = _getAdvance(c);
+        if ((c == '\n') || (c == '\r') || (_cursorX + width + advance > screenSizeX())) {
+            if (k > start) _gText(_cursorX, _cursorY, s + start, k - start, _cursorTextColour, _cursorBackColour, 1, 1);
+            _cursorX += width;
+            width = 0;
+            start = k;
+            if (c != '\r') {
+                _cursorX = _cursorX0;
+                _cursorY += fontSizeY();
+                if (_cursorY + fontSizeY() > screenSizeY()) _cursorY = 0;
             }
-#if (MAX_FONT_SIZE > 3)
-            else if (_fontSize == 3) {
-                for (k=0; k<s.length(); k++) {
-                    c = s.charAt(k)-' ';
-                    for (i=0; i<16; i++) {
-                        line  =_getCharacter(c, 3*i);
-                        line1 =_getCharacter(c, 3*i+1);
-                        line2 =_getCharacter(c, 3*i+2);
-                        for (j=0; j<8; j++) {
-                            if (bitRead(line, j))  point(x0 + 16*k + i, y0 + j,     textColour);
-                            else if (_fontSolid)   point(x0 + 16*k + i, y0 + j,     backColour);
-                            if (bitRead(line1, j)) point(x0 + 16*k + i, y0 +8 + j,  textColour);
-                            else if (_fontSolid)   point(x0 + 16*k + i, y0 +8 + j,  backColour);
-                            if (bitRead(line2, j)) point(x0 + 16*k + i, y0 +16 + j, textColour);
-                            else if (_fontSolid)   point(x0 + 16*k + i, y0 +16 + j, backColour);
-                        }
-                    }
-                }
+            if ((c == '\n') || (c == '\r')) {
+                start = k = next;
+                continue;
             }
-#endif
-#endif
-#endif
-#endif
+        }
+        width += advance;
+        k = next;
+    }
+    if (k > start) _gText(_cursorX, _cursorY, s + start, k - start, _cursorTextColour, _cursorBackColour, 1, 1);
+    _cursorX += width;
+}
+
+void LCD_screen_font::_gText(uint16_t x0, uint16_t y0,
+                             const char *s, uint16_t length,
+                             uint16_t textColour, uint16_t backColour,
+                             uint8_t ix, uint8_t iy)
+{
+    uint8_t width = fontSizeX();
+    uint8_t height = fontSizeY();
+    uint16_t bits, k;
+    uint8_t i, j, c;
+    LCD_glyph glyph;
+
+    if (width == 0) return;
+
+    if (!_fontSolid) {
+        // Only the inked pixels are drawn, each glyph advances the pen
+        k = 0;
+        while (k < length) {
+            c = utf8Next(s, length, &k);
+            _getGlyph(c, glyph);
+            _gTextRuns(x0, y0, glyph, textColour, ix, iy);
+            x0 += _getAdvance(c) * ix;
         }
     } else {
-        uint8_t c;
-        uint8_t line, line1;
-        uint16_t x, y;
-        uint8_t i, j, k;
+        // One window per group of up to FONT_CACHE glyphs, filled row by row across them
+        // The boxes and advances of the group are decoded once, not on each row
+        // Scaled text: each glyph row is expanded by ix and sent iy times
         uint8_t highTextColour = highByte(textColour);
         uint8_t lowTextColour = lowByte(textColour);
         uint8_t highBackColour = highByte(backColour);
         uint8_t lowBackColour = lowByte(backColour);
-#if (MAX_FONT_SIZE > 0)
-        if (_fontSize == 0) {
-            for (k=0; k<s.length(); k++) {
-                c = s.charAt(k)-' ';
-                _setWindow(x0 +fontSizeX()*k, y0, x0 +fontSizeX()*(k+1)-1, y0+fontSizeY()-1);
-                for (j=0; j<8; j++) {
-                    for (i=0; i<6; i++) {
-                        line = _getCharacter(c, i);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
+        LCD_glyph glyphs[FONT_CACHE];
+        uint8_t advances[FONT_CACHE];
+        uint16_t total, next;
+        uint8_t count, g, n, r;
+
+        // Whole characters only, up to the right edge
+        if (x0 >= screenSizeX()) return;
+        k = 0;
+        while (k < length) {
+            total = 0;
+            count = 0;
+            while ((k < length) && (count < FONT_CACHE)) {
+                next = k;
+                c = (uint8_t)s[k];
+                if (c < 0x80) next++;
+                else c = utf8Next(s, length, &next);
+                advances[count] = _getAdvance(c);
+                if (x0 + total + advances[count] * ix > screenSizeX()) {
+                    length = k;
+                    break;
                 }
+                _getGlyph(c, glyphs[count]);
+                total += advances[count] * ix;
+                count++;
+                k = next;
             }
-        }
-#if (MAX_FONT_SIZE > 1)
-        else if (_fontSize == 1) {
-            for (k=0; k<s.length(); k++) {
-                c = s.charAt(k)-' ';
-                _setWindow(x0 +fontSizeX()*k, y0, x0 +fontSizeX()*(k+1)-1, y0+fontSizeY()-1);
-                for (j=0; j<8; j++) {
-                    for (i=0; i<8; i++) {
-                        line = _getCharacter(c, 2*i);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
-                }
-                for (j=0; j<4; j++) {
-                    for (i=0; i<8; i++) {
-                        line = _getCharacter(c, 2*i+1);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
+            if (total == 0) return;
+
+            _setWindow(x0, y0, x0 + total - 1, y0 + height * iy - 1);
+            for (j=0; j<height; j++) {
+                for (r=0; r<iy; r++) {
+                    for (g=0; g<count; g++) {
+                        bits = _getGlyphRow(glyphs[g], j);
+                        for (i=0; i<advances[g]; i++) {
+                            if (bits & 0x01) {
+                                for (n=0; n<ix; n++) _writeData88(highTextColour, lowTextColour);
+                            } else {
+                                for (n=0; n<ix; n++) _writeData88(highBackColour, lowBackColour);
+                            }
+                            bits >>= 1;
                         }
                     }
                 }
             }
+            x0 += total;
         }
-#if (MAX_FONT_SIZE > 2)
-        else if (_fontSize == 2) {
-            for (k=0; k<s.length(); k++) {
-                c = s.charAt(k)-' ';
-                _setWindow(x0 +fontSizeX()*k, y0, x0 +fontSizeX()*(k+1)-1, y0+fontSizeY()-1);
-                for (j=0; j<8; j++) {
-                    for (i=0; i<12; i++) {
-                        line = _getCharacter(c, 2*i);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
-                }
-                for (j=0; j<8; j++) {
-                    for (i=0; i<12; i++) {
-                        line = _getCharacter(c, 2*i+1);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
-                }
+    }
+}
+
+// Transparent glyph: lit pixels are grouped into rectangles, each one drawn as a
+// single windowed burst. A horizontal run is extended down over the next rows
+// as long as they contain the same run, so stems and bars become one rectangle.
+void LCD_screen_font::_gTextRuns(uint16_t x0, uint16_t y0, const LCD_glyph &glyph,
+                                 uint16_t textColour, uint8_t ix, uint8_t iy)
+{
+    uint16_t rows[MAX_FONT_HEIGHT];
+    uint16_t bits, mask;
+    uint8_t height = fontSizeY();
+    uint8_t i, j, n, last;
+
+    if (glyph.height == 0) return;
+    if (height > MAX_FONT_HEIGHT) height = MAX_FONT_HEIGHT;
+    for (j=0; j<height; j++) rows[j] = _getGlyphRow(glyph, j);
+
+    for (j=0; j<height; j++) {
+        while (rows[j] != 0) {
+            // Run of set bits starting at the lowest one, columns i..n-1
+            bits = rows[j];
+            i = 0;
+            while ((bits & 0x01) == 0) {
+                bits >>= 1;
+                i++;
             }
-        }
-#if (MAX_FONT_SIZE > 3)
-        else if (_fontSize == 3) {
-            for (k=0; k<s.length(); k++) {
-                c = s.charAt(k)-' ';
-                _setWindow(x0 +fontSizeX()*k, y0, x0 +fontSizeX()*(k+1)-1, y0+fontSizeY()-1);
-                for (j=0; j<8; j++) {
-                    for (i=0; i<16; i++) {
-                        line = _getCharacter(c, 3*i);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
-                }
-                for (j=0; j<8; j++) {
-                    for (i=0; i<16; i++) {
-                        line = _getCharacter(c, 3*i+1);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
-                }
-                for (j=0; j<8; j++) {
-                    for (i=0; i<16; i++) {
-                        line = _getCharacter(c, 3*i+2);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
-                }
+            n = i;
+            while (bits & 0x01) {
+                bits >>= 1;
+                n++;
+            }
+            mask = ((n < 16) ? ((uint16_t)1 << n) : 0) - ((uint16_t)1 << i);
+
+            // Same run on the rows below
+            last = j;
+            rows[j] &= ~mask;
+            while ((last+1 < height) && ((rows[last+1] & mask) == mask)) {
+                last++;
+                rows[last] &= ~mask;
+            }
+
+            if ((ix == 1) && (iy == 1) && (n == i+1) && (last == j)) {
+                _setPoint(x0 + i, y0 + j, textColour);
+            } else {
+                _fastFill(x0 + i*ix, y0 + j*iy, x0 + n*ix - 1, y0 + (last+1)*iy - 1, textColour);
             }
         }
-#endif
-#endif
-#endif
-#endif
     }
 }
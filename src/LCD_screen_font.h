@@ -31,38 +31,52 @@
 #if LCD_SCREEN_RELEASE < 114
 #error Required LCD_SCREEN_RELEASE 114
 #endif
-#if defined(__LM4F120H5QR__) || defined(__32MX320F128H__) || defined(__AVR_ATmega2560__)
-#define MAX_FONT_SIZE 3
-#elif defined(__MSP430F5529)
-#define MAX_FONT_SIZE 2
-#else
-#define MAX_FONT_SIZE 1
-#endif
-#if (MAX_FONT_SIZE > 0)
-#include "Terminal6e.h"
-#if (MAX_FONT_SIZE > 1)
-#include "Terminal8e.h"
-#if (MAX_FONT_SIZE > 2)
-#include "Terminal12e.h"
-#if (MAX_FONT_SIZE > 3)
-#include "Terminal16e.h"
-#endif
-#endif
-#endif
-#endif
-class LCD_screen_font : public LCD_screen {
+#define MAX_FONT_SIZE 4
+#define MAX_FONT_HEIGHT 24
+#include "LCD_font.h"
+#include "Terminal6c.h"
+#include "Terminal8c.h"
+#include "Terminal12c.h"
+#include "Terminal16c.h"
+class LCD_screen_font : public LCD_screen, public Print {
 public:
     LCD_screen_font();
     virtual void setFontSize(uint8_t font = 0);
     virtual uint8_t fontMax();
     virtual uint8_t fontSizeX();
     virtual uint8_t fontSizeY();
-    virtual void gText(uint16_t x0, uint16_t y0,
-                       String s,
-                       uint16_t textColour = whiteColour, uint16_t backColour = blackColour,
-                       uint8_t ix = 1, uint8_t iy = 1);
+    void setFont(const LCD_font *font);
+    const LCD_font *getFont();
+    uint16_t textWidth(const char *s, uint8_t ix = 1);
+    uint16_t textWidth(const String &s, uint8_t ix = 1);
+    // Bytes of the start of s that fits in dx pixels, without cutting a UTF-8 sequence, its width in width
+    uint16_t textFit(const char *s, uint16_t dx, uint16_t &width, uint8_t ix = 1);
+    void gTextUpdate(uint16_t x0, uint16_t y0,
+                     const char *s, char *previous, uint8_t size,
+                     uint16_t textColour = whiteColour, uint16_t backColour = blackColour,
+                     uint8_t ix = 1, uint8_t iy = 1);
+    void setCursor(uint16_t x0, uint16_t y0);
+    uint16_t getCursorX();
+    uint16_t getCursorY();
+    void setTextColour(uint16_t textColour = whiteColour, uint16_t backColour = blackColour);
+    virtual size_t write(uint8_t c);
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    using Print::write;
 protected:
-    uint8_t _getCharacter(uint8_t c, uint8_t i);
+    const LCD_font *_font;
+    uint16_t _cursorX, _cursorY, _cursorX0;
+    uint16_t _cursorTextColour, _cursorBackColour;
+    char _utf8[4];
+    uint8_t _utf8Count;
+    void _getGlyph(uint8_t c, LCD_glyph &glyph);
+    uint16_t _getGlyphRow(const LCD_glyph &glyph, uint8_t j);
+    uint8_t _getAdvance(uint8_t c);
+    uint16_t _textWidth(const char *s, uint16_t length);
+    void _writeText(const char *s, uint16_t length);
+    void _gText(uint16_t x0, uint16_t y0, const char *s, uint16_t length,
+                uint16_t textColour, uint16_t backColour, uint8_t ix, uint8_t iy);
+    void _gTextRuns(uint16_t x0, uint16_t y0, const LCD_glyph &glyph,
+                    uint16_t textColour, uint8_t ix, uint8_t iy);
     virtual void _fastFill(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour) =0;
     virtual void _setPoint(uint16_t x1, uint16_t y1, uint16_t colour) =0;
     virtual void _getRawTouch(uint16_t &x0, uint16_t &y0, uint16_t &z0) =0;
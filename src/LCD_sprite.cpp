@@ -0,0 +1,203 @@
+// LCD_sprite.cpp
+//
+// Sprite layer for LCD_screen based displays
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+// Library header
+#include "LCD_sprite.h"
+
+// Code
+LCD_sprite::LCD_sprite()
+{
+    _screen             = NULL;
+    _pixels             = NULL;
+    _mask               = NULL;
+    _saveUnder          = NULL;
+    _backgroundFunction = NULL;
+    _dx = _dy = 0;
+    _x = _y = 0;
+    _colourKey  = 0;
+    _backColour = blackColour;
+    _visible    = false;
+    _flagKey    = false;
+}
+
+void LCD_sprite::begin(LCD_screen *screen, uint16_t dx, uint16_t dy, const uint16_t *pixels, uint16_t *saveUnder)
+{
+    _screen    = screen;
+    _dx        = dx;
+    _dy        = dy;
+    _pixels    = pixels;
+    _saveUnder = saveUnder;
+    _visible   = false;
+}
+
+void LCD_sprite::setMask(const uint8_t *mask)
+{
+    _mask = mask;
+}
+
+void LCD_sprite::setColourKey(uint16_t colourKey)
+{
+    _colourKey = colourKey;
+    _flagKey   = true;
+}
+
+void LCD_sprite::setBackground(LCD_backgroundFunction background)
+{
+    _backgroundFunction = background;
+}
+
+void LCD_sprite::setBackground(uint16_t colour)
+{
+    _backgroundFunction = NULL;
+    _backColour = colour;
+}
+
+void LCD_sprite::setPixels(const uint16_t *pixels)
+{
+    _pixels = pixels;
+    if (_visible) _draw();
+}
+
+bool LCD_sprite::isVisible()
+{
+    return _visible;
+}
+
+void LCD_sprite::show(uint16_t x0, uint16_t y0)
+{
+    if (_visible) {
+        moveTo(x0, y0);
+        return;
+    }
+    if (x0 + _dx > _screen->screenSizeX()) x0 = _screen->screenSizeX() - _dx;
+    if (y0 + _dy > _screen->screenSizeY()) y0 = _screen->screenSizeY() - _dy;
+    _capture(x0, y0);
+    _x = x0;
+    _y = y0;
+    _visible = true;
+    _draw();
+}
+
+void LCD_sprite::moveTo(uint16_t x0, uint16_t y0)
+{
+    if (!_visible) {
+        show(x0, y0);
+        return;
+    }
+    if (x0 + _dx > _screen->screenSizeX()) x0 = _screen->screenSizeX() - _dx;
+    if (y0 + _dy > _screen->screenSizeY()) y0 = _screen->screenSizeY() - _dy;
+    if ((x0 == _x) && (y0 == _y)) return;
+
+    // Old box A, new box B
+    int16_t ax1 = _x, ay1 = _y, ax2 = _x + _dx - 1, ay2 = _y + _dy - 1;
+    int16_t bx1 = x0, by1 = y0, bx2 = x0 + _dx - 1, by2 = y0 + _dy - 1;
+
+    // Restore A minus B: top band, bottom band, then left and right of the overlap
+    if ((bx1 > ax2) || (bx2 < ax1) || (by1 > ay2) || (by2 < ay1)) {
+        _restore(ax1, ay1, ax2, ay2);
+    } else {
+        if (ay1 < by1) _restore(ax1, ay1, ax2, by1-1);
+        if (ay2 > by2) _restore(ax1, by2+1, ax2, ay2);
+        int16_t my1 = max(ay1, by1);
+        int16_t my2 = min(ay2, by2);
+        if (ax1 < bx1) _restore(ax1, my1, bx1-1, my2);
+        if (ax2 > bx2) _restore(bx2+1, my1, ax2, my2);
+    }
+
+    _capture(x0, y0);
+    _x = x0;
+    _y = y0;
+    _draw();
+}
+
+void LCD_sprite::hide()
+{
+    if (!_visible) return;
+    _restore(_x, _y, _x + _dx - 1, _y + _dy - 1);
+    _visible = false;
+}
+
+bool LCD_sprite::_isOpaque(uint16_t index, uint16_t row, uint16_t column)
+{
+    if (_mask != NULL) {
+        return bitRead(_mask[row * ((_dx + 7) >> 3) + (column >> 3)], 7 - (column & 0x07));
+    }
+    if (_flagKey) return (_pixels[index] != _colourKey);
+    return true;
+}
+
+uint16_t LCD_sprite::_getBackground(uint16_t x, uint16_t y)
+{
+    if (_backgroundFunction != NULL) return _backgroundFunction(x, y);
+    return _backColour;
+}
+
+// Repaint a part of the old box with the pixels that were under the sprite
+void LCD_sprite::_restore(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+    _screen->setWindow(x1, y1, x2, y2);
+    for (int16_t y = y1; y <= y2; y++) {
+        if (_saveUnder != NULL) {
+            _screen->writeColours(_saveUnder + (y - _y) * _dx + (x1 - _x), x2 - x1 + 1);
+        } else {
+            for (int16_t x = x1; x <= x2; x++) _screen->writeColour(_getBackground(x, y));
+        }
+    }
+}
+
+// Fill the save-under buffer for the box at (x0, y0)
+// Pixels shared with the current box are moved within the buffer, the others
+// are read back from the screen or requested from the background provider.
+// The buffer is walked like memmove, so sources are read before being overwritten.
+void LCD_sprite::_capture(uint16_t x0, uint16_t y0)
+{
+    if (_saveUnder == NULL) return;
+
+    int16_t  dr = (int16_t)y0 - (int16_t)_y;
+    int16_t  dc = (int16_t)x0 - (int16_t)_x;
+    int32_t  offset = (int32_t)dr * _dx + dc;
+    uint16_t size = _dx * _dy;
+    bool     readable = _screen->isReadable();
+
+    for (uint16_t n = 0; n < size; n++) {
+        uint16_t index  = (offset >= 0) ? n : size - 1 - n;
+        uint16_t row    = index / _dx;
+        uint16_t column = index - row * _dx;
+        int16_t  oldRow    = row + dr;
+        int16_t  oldColumn = column + dc;
+
+        if (_visible && (oldRow >= 0) && (oldRow < (int16_t)_dy) && (oldColumn >= 0) && (oldColumn < (int16_t)_dx)) {
+            _saveUnder[index] = _saveUnder[index + offset];
+        } else if (readable) {
+            _saveUnder[index] = _screen->readPixel(x0 + column, y0 + row);
+        } else {
+            _saveUnder[index] = _getBackground(x0 + column, y0 + row);
+        }
+    }
+}
+
+// Draw the whole sprite box in a single window
+void LCD_sprite::_draw()
+{
+    uint16_t index = 0;
+
+    _screen->setWindow(_x, _y, _x + _dx - 1, _y + _dy - 1);
+    for (uint16_t row = 0; row < _dy; row++) {
+        for (uint16_t column = 0; column < _dx; column++) {
+            if (_isOpaque(index, row, column)) {
+                _screen->writeColour(_pixels[index]);
+            } else if (_saveUnder != NULL) {
+                _screen->writeColour(_saveUnder[index]);
+            } else {
+                _screen->writeColour(_getBackground(_x + column, _y + row));
+            }
+            index++;
+        }
+    }
+}
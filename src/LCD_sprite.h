@@ -0,0 +1,128 @@
+// LCD_sprite.h
+//
+// Sprite layer for LCD_screen based displays
+//
+// A sprite is a small dx * dy RGB565 image drawn on top of the screen
+// content. Transparency is given either by a 1-bpp mask or by a colour key.
+// Moving a sprite only repaints the part of the old bounding box that is not
+// covered by the new one, then draws the sprite at its new position.
+//
+// The pixels under the sprite come from a save-under buffer when the screen
+// supports read-back, or from a background callback (or a flat colour) when
+// it does not, as on the Kentec parallel BoosterPack.
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include "Energia.h"
+
+#ifndef LCD_SPRITE_RELEASE
+///
+/// @brief	Library release number
+///
+#define LCD_SPRITE_RELEASE 100
+
+#include "LCD_screen.h"
+
+///
+/// @brief      Background provider
+/// @details    Returns the colour of the screen background at (x, y).
+/// @note       Called while a GRAM window is open: it must not draw.
+///
+typedef uint16_t (*LCD_backgroundFunction)(uint16_t x, uint16_t y);
+
+///
+/// @brief      Sprite with save-under and minimal-rectangle moves
+///
+class LCD_sprite {
+public:
+
+    ///
+    /// @brief	Constructor
+    ///
+    LCD_sprite();
+
+    ///
+    /// @brief	Attach the sprite to a screen
+    /// @param	screen pointer to the screen
+    /// @param	dx width of the sprite, pixels
+    /// @param	dy height of the sprite, pixels
+    /// @param	pixels dx * dy RGB565 colours, row-major
+    /// @param	saveUnder optional buffer of dx * dy colours, statically allocated by the caller
+    /// @note   Without saveUnder, the background is requested again on every redraw.
+    ///
+    void begin(LCD_screen *screen, uint16_t dx, uint16_t dy, const uint16_t *pixels, uint16_t *saveUnder = NULL);
+
+    ///
+    /// @brief	Set a 1-bpp transparency mask
+    /// @param	mask one bit per pixel, 1 = opaque, MSB = leftmost pixel, rows padded to a byte
+    ///
+    void setMask(const uint8_t *mask);
+
+    ///
+    /// @brief	Use a colour key for transparency
+    /// @param	colourKey pixels of this colour are transparent
+    ///
+    void setColourKey(uint16_t colourKey);
+
+    ///
+    /// @brief	Set the background provider
+    /// @param	background callback returning the background colour at (x, y)
+    ///
+    void setBackground(LCD_backgroundFunction background);
+
+    ///
+    /// @brief	Set a flat background colour
+    /// @param	colour background colour, used when no callback is set
+    ///
+    void setBackground(uint16_t colour);
+
+    ///
+    /// @brief	Change the image, redrawing the sprite in place if visible
+    /// @param	pixels dx * dy RGB565 colours, row-major
+    ///
+    void setPixels(const uint16_t *pixels);
+
+    ///
+    /// @brief	Draw the sprite at (x0, y0)
+    ///
+    void show(uint16_t x0, uint16_t y0);
+
+    ///
+    /// @brief	Move the sprite to (x0, y0)
+    /// @details Only the symmetric difference of the old and new bounding boxes is repainted.
+    ///
+    void moveTo(uint16_t x0, uint16_t y0);
+
+    ///
+    /// @brief	Remove the sprite and restore the background
+    ///
+    void hide();
+
+    ///
+    /// @brief	Sprite visibility
+    /// @return	true if the sprite is on screen
+    ///
+    bool isVisible();
+
+private:
+    LCD_screen *_screen;
+    const uint16_t *_pixels;
+    const uint8_t *_mask;
+    uint16_t *_saveUnder;
+    LCD_backgroundFunction _backgroundFunction;
+    uint16_t _dx, _dy;
+    uint16_t _x, _y;
+    uint16_t _colourKey, _backColour;
+    bool _visible, _flagKey;
+
+    bool _isOpaque(uint16_t index, uint16_t row, uint16_t column);
+    uint16_t _getBackground(uint16_t x, uint16_t y);
+    void _restore(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+    void _capture(uint16_t x0, uint16_t y0);
+    void _draw();
+};
+
+#endif
@@ -0,0 +1,176 @@
+// LCD_touch.cpp
+//
+// Touch event queue for LCD_screen based displays
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+// Library header
+#include "LCD_touch.h"
+
+#define TOUCH_MASK  (LCD_TOUCH_QUEUE - 1)
+
+static inline uint16_t _distance(uint16_t a, uint16_t b)
+{
+    return (a > b) ? a - b : b - a;
+}
+
+// Code
+LCD_touch::LCD_touch()
+{
+    _screen = NULL;
+    setFilter();
+    _windowIndex = _windowCount = 0;
+    _filterX = _filterY = 0;
+    _pressed = false;
+    _changeCount = 0;
+    _x = _y = _z = 0;
+    _head = _tail = 0;
+}
+
+void LCD_touch::begin(LCD_screen *screen)
+{
+    _screen = screen;
+    _windowIndex = _windowCount = 0;
+    _pressed = false;
+    _changeCount = 0;
+    flush();
+}
+
+void LCD_touch::setFilter(uint8_t median, uint8_t smoothing, uint16_t hysteresis, uint8_t debounce, uint8_t moveStep)
+{
+    _median     = constrain(median | 0x01, 1, LCD_TOUCH_MEDIAN);
+    _smoothing  = min(smoothing, 4);
+    _hysteresis = hysteresis;
+    _debounce   = max(debounce, 1);
+    _moveStep   = max(moveStep, 1);
+}
+
+bool LCD_touch::update()
+{
+    if (_screen == NULL) return false;
+
+    uint16_t x0, y0, z0;
+    if (!_screen->pollRawTouch(x0, y0, z0)) return false;
+
+    // Pressure thresholds around the touch threshold of the screen
+    uint16_t trim = _screen->touchTrim();
+    uint16_t release = (trim > _hysteresis) ? trim - _hysteresis : 0;
+    uint16_t press = trim + _hysteresis;
+    uint16_t x1 = 0, y1 = 0, z1 = 0;
+    bool high = false;
+
+    // Samples without pressure carry no position: they restart the median
+    if (z0 > release) {
+        _windowX[_windowIndex] = x0;
+        _windowY[_windowIndex] = y0;
+        _windowZ[_windowIndex] = z0;
+        _windowIndex = (_windowIndex + 1) % _median;
+        if (_windowCount < _median) _windowCount++;
+
+        x1 = _medianOf(_windowX);
+        y1 = _medianOf(_windowY);
+        z1 = _medianOf(_windowZ);
+        high = (z1 > (_pressed ? release : press));
+    } else {
+        _windowIndex = _windowCount = 0;
+    }
+
+    // Debouncing: the new state must be seen on consecutive samples
+    if (high != _pressed) {
+        if (++_changeCount < _debounce) return false;
+        _changeCount = 0;
+        _pressed = high;
+        if (_pressed) {
+            _filterX = (int32_t)x1 << 4;
+            _filterY = (int32_t)y1 << 4;
+            _screen->mapTouch(x1, y1, _x, _y);
+            _z = z1;
+            _push(TOUCH_DOWN);
+        } else {
+            // The up event keeps the last position
+            _z = 0;
+            _push(TOUCH_UP);
+        }
+        return true;
+    }
+    _changeCount = 0;
+    if (!_pressed) return false;
+
+    // IIR filter in 1/16 of raw unit
+    _filterX += (((int32_t)x1 << 4) - _filterX) >> _smoothing;
+    _filterY += (((int32_t)y1 << 4) - _filterY) >> _smoothing;
+    _z = z1;
+
+    uint16_t x, y;
+    _screen->mapTouch((_filterX + 8) >> 4, (_filterY + 8) >> 4, x, y);
+    if ((_distance(x, _x) < _moveStep) && (_distance(y, _y) < _moveStep)) return false;
+    _x = x;
+    _y = y;
+    _push(TOUCH_MOVE);
+    return true;
+}
+
+uint8_t LCD_touch::available()
+{
+    return (uint8_t)(_head - _tail);
+}
+
+bool LCD_touch::read(LCD_touchEvent &event)
+{
+    if (_head == _tail) return false;
+    event = _queue[_tail & TOUCH_MASK];
+    _tail++;
+    return true;
+}
+
+bool LCD_touch::isPressed()
+{
+    return _pressed;
+}
+
+void LCD_touch::getPosition(uint16_t &x, uint16_t &y)
+{
+    x = _x;
+    y = _y;
+}
+
+void LCD_touch::flush()
+{
+    _head = _tail = 0;
+}
+
+// Median of the window, sorted by insertion: 5 values at most
+uint16_t LCD_touch::_medianOf(const uint16_t *window)
+{
+    uint16_t sorted[LCD_TOUCH_MEDIAN];
+    uint8_t i, j;
+
+    for (i = 0; i < _windowCount; i++) {
+        uint16_t value = window[i];
+        for (j = i; (j > 0) && (sorted[j - 1] > value); j--) sorted[j] = sorted[j - 1];
+        sorted[j] = value;
+    }
+    return sorted[(_windowCount - 1) / 2];
+}
+
+void LCD_touch::_push(uint8_t type)
+{
+    LCD_touchEvent *event;
+
+    if ((type == TOUCH_MOVE) && (_head != _tail) && (_queue[(_head - 1) & TOUCH_MASK].type == TOUCH_MOVE)) {
+        // Coalesced with the move event still waiting
+        event = &_queue[(_head - 1) & TOUCH_MASK];
+    } else {
+        if ((uint8_t)(_head - _tail) == LCD_TOUCH_QUEUE) _tail++;
+        event = &_queue[_head & TOUCH_MASK];
+        _head++;
+    }
+    event->type = type;
+    event->x    = _x;
+    event->y    = _y;
+    event->z    = _z;
+    event->time = millis();
+}
@@ -0,0 +1,149 @@
+// LCD_touch.h
+//
+// Touch event queue for LCD_screen based displays
+//
+// The pipeline takes the raw samples of the screen, pollRawTouch(), and turns
+// them into down, move and up events. When a timer interrupt drives the
+// sampler of the screen, setTouchInterrupt(true), only the samples it publishes
+// are consumed:
+// * a median over the last samples removes the spikes of the resistive panel,
+// * a first-order IIR filter smooths the position while the panel is pressed,
+// * the pressure goes through a hysteresis around the touch threshold of the
+//   screen, and must stay on the same side for a few samples before a down or
+//   an up event, so a bouncing contact gives neither missed nor phantom taps,
+// * move events are only queued when the position changes by a few pixels.
+//
+// Events wait in a fixed ring buffer. A move event replaces a move event still
+// waiting at the end of the queue, and a full queue drops its oldest event.
+//
+// The filters only use shifts, additions and comparisons: update() costs a few
+// microseconds, plus the mapping of the position when a sample is complete.
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include "Energia.h"
+
+#ifndef LCD_TOUCH_RELEASE
+///
+/// @brief	Library release number
+///
+#define LCD_TOUCH_RELEASE 100
+
+#include "LCD_screen.h"
+
+///
+/// @brief	Size of the event queue, a power of 2
+///
+#define LCD_TOUCH_QUEUE 8
+
+///
+/// @brief	Largest median window
+///
+#define LCD_TOUCH_MEDIAN 5
+
+///
+/// @brief	Types of touch events
+///
+enum {TOUCH_DOWN = 1, TOUCH_MOVE = 2, TOUCH_UP = 3};
+
+///
+/// @brief      Touch event
+/// @details    Screen coordinates, with the orientation, raw pressure and time in ms
+///
+struct LCD_touchEvent {
+    uint8_t  type;
+    uint16_t x, y, z;
+    uint32_t time;
+};
+
+///
+/// @brief      Filtered touch with down, move and up events
+///
+class LCD_touch {
+public:
+
+    ///
+    /// @brief	Constructor
+    ///
+    LCD_touch();
+
+    ///
+    /// @brief	Attach the pipeline to a screen
+    /// @param	screen pointer to the screen, already started with touch enabled
+    ///
+    void begin(LCD_screen *screen);
+
+    ///
+    /// @brief	Tune the filters
+    /// @param	median number of samples of the median, odd, 1 to LCD_TOUCH_MEDIAN
+    /// @param	smoothing IIR coefficient as a shift, 0 for none, 2 for 1/4 of each new sample
+    /// @param	hysteresis pressure band around the touch threshold of the screen
+    /// @param	debounce consecutive samples needed to change the pressed state
+    /// @param	moveStep minimum change of the position, pixels, for a move event
+    ///
+    void setFilter(uint8_t median = 3, uint8_t smoothing = 2, uint16_t hysteresis = 16,
+                   uint8_t debounce = 2, uint8_t moveStep = 2);
+
+    ///
+    /// @brief	Advance the pipeline
+    /// @return	true when a new event has been queued
+    /// @note   Call it from loop() as often as possible: with the Kentec
+    /// @n      screen, each call advances the non-blocking sampler by one phase.
+    ///
+    bool update();
+
+    ///
+    /// @brief	Number of events waiting
+    ///
+    uint8_t available();
+
+    ///
+    /// @brief	Take the oldest event
+    /// @param	event the event
+    /// @return	false if the queue is empty
+    ///
+    bool read(LCD_touchEvent &event);
+
+    ///
+    /// @brief	Pressed state after debouncing
+    ///
+    bool isPressed();
+
+    ///
+    /// @brief	Filtered position
+    /// @param	x screen x of the last event
+    /// @param	y screen y of the last event
+    ///
+    void getPosition(uint16_t &x, uint16_t &y);
+
+    ///
+    /// @brief	Empty the queue
+    ///
+    void flush();
+
+private:
+    LCD_screen *_screen;
+    uint8_t _median, _smoothing, _debounce, _moveStep;
+    uint16_t _hysteresis;
+
+    // Median windows, ring of the last samples
+    uint16_t _windowX[LCD_TOUCH_MEDIAN], _windowY[LCD_TOUCH_MEDIAN], _windowZ[LCD_TOUCH_MEDIAN];
+    uint8_t _windowIndex, _windowCount;
+
+    // IIR state, raw coordinates << 4
+    int32_t _filterX, _filterY;
+    bool _pressed;
+    uint8_t _changeCount;
+    uint16_t _x, _y, _z;
+
+    LCD_touchEvent _queue[LCD_TOUCH_QUEUE];
+    uint8_t _head, _tail;
+
+    uint16_t _medianOf(const uint16_t *window);
+    void _push(uint8_t type);
+};
+
+#endif
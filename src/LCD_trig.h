@@ -0,0 +1,55 @@
+///
+/// @file       LCD_trig.h
+/// @brief      Fixed-point trigonometry tables
+/// @details    Quarter-wave sine in Q15, 128 steps, and arc tangent in binary angle
+/// @n          units, 65536 per turn, for ratios 0 to 1 in 64 steps, see LCD_utilities.h
+/// @n          Generated by extras/Tools/trig_tables.py, do not edit
+///
+/// @n          https://github.com/Andy4495/Kentec_35_Parallel
+/// @n          This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+/// @n          See LICENSE file at above github repository
+///
+
+#ifndef LCD_TRIG_RELEASE
+#define LCD_TRIG_RELEASE 100
+
+#define LCD_SINE_STEPS 128
+#define LCD_ATAN_STEPS 64
+
+// sin(k * 90 / LCD_SINE_STEPS degrees) * 32768, 32767 max
+static const int16_t _sineQ15[LCD_SINE_STEPS + 1] =
+{
+         0,    402,    804,   1206,   1608,   2009,   2411,   2811,
+      3212,   3612,   4011,   4410,   4808,   5205,   5602,   5998,
+      6393,   6787,   7180,   7571,   7962,   8351,   8740,   9127,
+      9512,   9896,  10279,  10660,  11039,  11417,  11793,  12167,
+     12540,  12910,  13279,  13646,  14010,  14373,  14733,  15091,
+     15447,  15800,  16151,  16500,  16846,  17190,  17531,  17869,
+     18205,  18538,  18868,  19195,  19520,  19841,  20160,  20475,
+     20788,  21097,  21403,  21706,  22006,  22302,  22595,  22884,
+     23170,  23453,  23732,  24008,  24279,  24548,  24812,  25073,
+     25330,  25583,  25833,  26078,  26320,  26557,  26791,  27020,
+     27246,  27467,  27684,  27897,  28106,  28311,  28511,  28707,
+     28899,  29086,  29269,  29448,  29622,  29792,  29957,  30118,
+     30274,  30425,  30572,  30715,  30853,  30986,  31114,  31238,
+     31357,  31471,  31581,  31686,  31786,  31881,  31972,  32058,
+     32138,  32214,  32286,  32352,  32413,  32470,  32522,  32568,
+     32610,  32647,  32679,  32706,  32729,  32746,  32758,  32766,
+     32767,
+};
+
+// atan(k / LCD_ATAN_STEPS) * 65536 / 2pi
+static const uint16_t _atanAngle[LCD_ATAN_STEPS + 1] =
+{
+         0,    163,    326,    489,    651,    813,    975,   1136,
+      1297,   1457,   1617,   1775,   1933,   2090,   2246,   2401,
+      2555,   2708,   2860,   3010,   3159,   3307,   3453,   3599,
+      3742,   3884,   4025,   4164,   4302,   4438,   4572,   4705,
+      4836,   4966,   5094,   5220,   5344,   5467,   5589,   5708,
+      5826,   5943,   6058,   6171,   6282,   6392,   6500,   6607,
+      6712,   6815,   6917,   7018,   7117,   7214,   7310,   7405,
+      7498,   7589,   7679,   7768,   7856,   7942,   8026,   8110,
+      8192,
+};
+
+#endif
@@ -1,172 +1,397 @@
-//
-// LCD_utilities.cpp
-// Library C++ code
-// ----------------------------------
-// Developed with embedXcode
-// http://embedXcode.weebly.com
-//
-// Project LCD_screen
-//
-// Created by Rei VILO, Jun 01, 2013
-// embedXcode.weebly.com
-//
-//
-// Copyright © Rei VILO, 2013
-// License CC = BY NC SA
-//
-// See LCD_utilities.h and ReadMe.txt for references
-//
-
-#include <stdio.h>
-
-// Library header
-#include "LCD_utilities.h"
-
-char bufferIn[128];
-char bufferOut[128];
-char bufferFormat[32];
-
-int32_t cos32x100(int32_t degreesX100)
-{
-    int32_t i = 1;
-    
-    if (degreesX100<0) { i = -i; degreesX100 = -degreesX100; }
-    
-    degreesX100 %= 36000;
-    
-    if (degreesX100>9000) {
-        if (degreesX100<18000)      { i = -i; degreesX100 = 18000-degreesX100; }
-        else if (degreesX100<27000) { i = -i; degreesX100 = degreesX100-18000; }
-        else              {         degreesX100 = 36000-degreesX100; }
-    }
-    
-    if (degreesX100< 1000)      return i * map(degreesX100,    0, 1000, 100, 98);
-    else if (degreesX100< 2000) return i * map(degreesX100, 1000, 2000,  98, 93);
-    else if (degreesX100< 3000) return i * map(degreesX100, 2000, 3000,  93, 86);
-    else if (degreesX100< 4000) return i * map(degreesX100, 3000, 4000,  86, 76);
-    else if (degreesX100< 5000) return i * map(degreesX100, 4000, 5000,  76, 64);
-    else if (degreesX100< 6000) return i * map(degreesX100, 5000, 6000,  64, 50);
-    else if (degreesX100< 7000) return i * map(degreesX100, 6000, 7000,  50, 34);
-    else if (degreesX100< 8000) return i * map(degreesX100, 7000, 8000,  34, 17);
-    else              return i * map(degreesX100, 8000, 9000,  17,  0);
-}
-
-int32_t sin32x100(int32_t degreesX100)
-{
-    return cos32x100(degreesX100+27000);
-}
-
-String utf2iso(String s)
-{
-    uint8_t c;
-    
-    s.toCharArray(bufferIn, s.length());
-    
-    memset(&bufferOut, 0x00, sizeof(bufferOut));
-    
-    
-    for (uint8_t i=0; i<strlen(bufferIn); i++) {
-        c = (uint8_t)bufferIn[i];
-        
-        if (c < 128) {
-            bufferOut[strlen(bufferOut)] = c;
-        } else if (c == 0xc3) {
-            bufferOut[strlen(bufferOut)] = (bufferIn[++i] + 64);
-        } else if (c == 0xc2) {
-            bufferOut[strlen(bufferOut)] = bufferIn[++i];
-        } else if (c == 0xe2) {
-            if ((bufferIn[i+1] == 0x82) && (bufferIn[i+2] == 0xac)) {
-                bufferOut[strlen(bufferOut)] = 128;
-                i += 2;
-            }
-        }
-        bufferOut[strlen(bufferOut)] = 0;
-    }
-    return bufferOut;
-}
-
-String i32toa(int32_t number, int32_t unit, uint8_t decimal, uint8_t size)
-{
-    
-	memset(&bufferIn, 0x00, sizeof(bufferIn));
-	memset(&bufferOut, 0x00, sizeof(bufferOut));
-    
-	int32_t multiplier = 1;
-	for (uint8_t i=0; i<decimal; i++) multiplier *= 10;
-	number = (number * multiplier *10 / unit +5) /10 ;
-    
-	if (decimal > 0) {
-		if (size>decimal) sprintf(bufferFormat, "%%%dd.", size-decimal-1);
-		else strcpy(bufferFormat, "%0d.");
-		sprintf(bufferOut, bufferFormat, number/multiplier);
-        
-		if (number < 0) number  = -number;
-		sprintf(bufferFormat, "%%0%dd", decimal);
-		sprintf(bufferOut+strlen(bufferOut), bufferFormat, number%multiplier);
-        
-	} else {
-		sprintf(bufferFormat, "%%%dd", size);
-		sprintf(bufferOut, bufferFormat, number/multiplier);
-	}
-    
-	if ((size > 0) && (strlen(bufferOut)>size)) strcpy(bufferOut, "#");
-	return bufferOut;
-}
-
-String htoa(uint32_t number, uint8_t size)
-{
-    sprintf(bufferFormat, "%%0%dx", size);
-    sprintf(bufferOut, bufferFormat, number);
-    
-    if ((size > 0) && (strlen(bufferOut)>size)) strcpy(bufferOut, "#");
-    
-    return bufferOut;
-}
-
-
-String ttoa(uint32_t number, uint8_t size)
-{
-    String s = "";
-    memset(&bufferOut, 0x00, sizeof(bufferOut));
-    
-    if (number < (uint32_t)1000) {
-        sprintf(bufferFormat, "%%%ddms", (size>2) ? size-2 : 0);
-        sprintf(bufferOut, bufferFormat, number);
-    } else if (number < (uint32_t)60000) {
-        number /= 100;
-        sprintf(bufferFormat, "%%%dd", (size>3) ? size-3 : 0);
-        sprintf(bufferOut, bufferFormat, number/10);
-        sprintf(bufferOut+strlen(bufferOut), ".%ds", number%10);
-    } else if (number < (uint32_t)3600000) {
-        number /= (uint32_t)6000;
-        sprintf(bufferFormat, "%%%dd", (size>4) ? size-4 : 0);
-        sprintf(bufferOut, bufferFormat, number/10);
-        sprintf(bufferOut+strlen(bufferOut), ".%dmn", number%10);
-    } else {
-        number /= (uint32_t)360000;
-        sprintf(bufferFormat, "%%%dd", (size>3) ? size-3 : 0);
-        sprintf(bufferOut, bufferFormat, number/10);
-        sprintf(bufferOut+strlen(bufferOut), ".%dh", number%10);
-    }
-    
-    return bufferOut;
-}
-
-
-String btoa(uint16_t number, uint8_t size)
-{
-    if (size < 8) return "#";
-    
-    memset(&bufferOut, 0x00, sizeof(bufferOut));
-    memset(&bufferOut, '0', size);
-    uint8_t i = size;
-    
-    while ((number>0) && (i>0)) {
-        bufferOut[--i] = '0'+(number%2);
-        number >>= 1;
-    }
-    if (i==0) strcpy(bufferOut, "#");
-    
-    return bufferOut;
-}
-
+//
+// LCD_utilities.cpp
+// Library C++ code
+// ----------------------------------
+// Developed with embedXcode
+// http://embedXcode.weebly.com
+//
+// Project LCD_screen
+//
+// Created by Rei VILO, Jun 01, 2013
+// embedXcode.weebly.com
+//
+//
+// Copyright © Rei VILO, 2013
+// License CC = BY NC SA
+//
+// See LCD_utilities.h and ReadMe.txt for references
+//
+
+// Library header
+#include "LCD_utilities.h"
+#include "LCD_trig.h"
+
+// Decimal digits of number, most significant first, returns the length
+// MSP430 has no hardware divider: each digit is found by subtracting powers of ten.
+// Other MCUs divide by the constant 10, which the compiler turns into a multiplication.
+static uint8_t _decimalDigits(char *buffer, uint32_t number)
+{
+    uint8_t length = 0;
+
+#if defined(__MSP430__)
+    static const uint32_t powers[9] = {
+        1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10
+    };
+
+    for (uint8_t k = 0; k < 9; k++) {
+        char digit = '0';
+        while (number >= powers[k]) {
+            number -= powers[k];
+            digit++;
+        }
+        if ((length > 0) || (digit > '0')) buffer[length++] = digit;
+    }
+    buffer[length++] = '0' + (char)number;
+#else
+    char digits[10];
+    uint8_t n = 0;
+
+    do {
+        digits[n++] = '0' + (char)(number % 10);
+        number /= 10;
+    } while (number > 0);
+    while (n > 0) buffer[length++] = digits[--n];
+#endif
+
+    return length;
+}
+
+// Right-align the length characters of buffer to size with fill, returns the new length
+static uint8_t _pad(char *buffer, uint8_t length, uint8_t size, char fill)
+{
+    if (length < size) {
+        memmove(buffer + size - length, buffer, length);
+        memset(buffer, fill, size - length);
+        length = size;
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+// "#" when the string is wider than size
+static uint8_t _overflow(char *buffer, uint8_t length, uint8_t size)
+{
+    if ((size > 0) && (length > size)) {
+        buffer[0] = '#';
+        buffer[1] = '\0';
+        return 1;
+    }
+    return length;
+}
+
+int16_t sinQ15(uint16_t angle)
+{
+    bool negative = (angle & 0x8000);
+    uint8_t index, fraction;
+    int16_t value;
+
+    // First quadrant, the second one mirrors it
+    angle &= 0x7FFF;
+    if (angle > 0x4000) angle = 0x8000 - angle;
+
+    index = angle / (0x4000 / LCD_SINE_STEPS);
+    fraction = angle % (0x4000 / LCD_SINE_STEPS);
+    value = _sineQ15[index];
+    if (fraction > 0) {
+        // The table rises: the difference and the product stay unsigned 16-bit
+        value += ((uint16_t)(_sineQ15[index + 1] - value) * fraction + (0x4000 / LCD_SINE_STEPS / 2)) / (0x4000 / LCD_SINE_STEPS);
+    }
+    return negative ? -value : value;
+}
+
+int16_t cosQ15(uint16_t angle)
+{
+    return sinQ15(angle + 0x4000);
+}
+
+// Angle of a ratio from 0 to 1, first octant
+static uint16_t _atanRatio(uint32_t small, uint32_t large)
+{
+    uint16_t ratio, value;
+    uint8_t index, fraction;
+
+    // Ratio in Q14, small << 14 kept within 32 bits
+    while (large > 0x1FFFF) {
+        large >>= 1;
+        small >>= 1;
+    }
+    ratio = (small << 14) / large;
+
+    index = ratio / (0x4000 / LCD_ATAN_STEPS);
+    fraction = ratio % (0x4000 / LCD_ATAN_STEPS);
+    value = _atanAngle[index];
+    if (fraction > 0) {
+        value += ((uint16_t)(_atanAngle[index + 1] - value) * fraction + (0x4000 / LCD_ATAN_STEPS / 2)) / (0x4000 / LCD_ATAN_STEPS);
+    }
+    return value;
+}
+
+uint16_t atan2Angle(int32_t y, int32_t x)
+{
+    uint32_t ax = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    uint32_t ay = (y < 0) ? -(uint32_t)y : (uint32_t)y;
+    uint16_t angle;
+
+    if ((ax == 0) && (ay == 0)) return 0;
+
+    if (ay <= ax) angle = _atanRatio(ay, ax);
+    else angle = 0x4000 - _atanRatio(ax, ay);
+    if (x < 0) angle = 0x8000 - angle;
+    if (y < 0) angle = -angle;
+    return angle;
+}
+
+uint16_t isqrt32(uint32_t value)
+{
+    uint32_t result = 0;
+    uint32_t bit = (uint32_t)1 << 30;
+
+    while (bit > value) bit >>= 2;
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t)result;
+}
+
+// Hundredths of degree to binary angle, 65536 / 36000 in Q14
+static uint16_t _angle32x100(int32_t degreesX100)
+{
+    degreesX100 %= 36000;
+    if (degreesX100 < 0) degreesX100 += 36000;
+    return ((uint32_t)degreesX100 * 29826 + 8192) >> 14;
+}
+
+int32_t cos32x100(int32_t degreesX100)
+{
+    return ((int32_t)cosQ15(_angle32x100(degreesX100)) * 100 + 16384) >> 15;
+}
+
+int32_t sin32x100(int32_t degreesX100)
+{
+    return ((int32_t)sinQ15(_angle32x100(degreesX100)) * 100 + 16384) >> 15;
+}
+
+uint8_t utf8Length(uint8_t c)
+{
+    if (c < 0xC2) return 1;         // ASCII, continuation or overlong lead
+    if (c < 0xE0) return 2;
+    if (c < 0xF0) return 3;
+    if (c < 0xF5) return 4;
+    return 1;
+}
+
+uint8_t utf8Next(const char *s, uint16_t length, uint16_t *index)
+{
+    uint8_t c = (uint8_t)s[*index];
+    uint8_t n = utf8Length(c);
+    uint32_t code;
+
+    (*index)++;
+    if (n == 1) return c;
+
+    // Incomplete sequence: the lead byte stands for itself
+    if (*index + n - 1 > length) return c;
+    code = c & (0x7F >> n);
+    for (uint8_t k = 0; k < n - 1; k++) {
+        c = (uint8_t)s[*index + k];
+        if ((c & 0xC0) != 0x80) return (uint8_t)s[*index - 1];
+        code = (code << 6) | (c & 0x3F);
+    }
+    *index += n - 1;
+
+    if (code < 0x100) return (uint8_t)code;
+    if (code == 0x20AC) return 0x80;
+    return LCD_UTF8_UNKNOWN;
+}
+
+String utf2iso(String s)
+{
+    const char *buffer = s.c_str();
+    uint16_t length = s.length();
+    uint16_t index = 0;
+    String result;
+
+    result.reserve(length);
+    while (index < length) result += (char)utf8Next(buffer, length, &index);
+    return result;
+}
+
+uint8_t i32toa(char *buffer, int32_t number, int32_t unit, uint8_t decimal, uint8_t size)
+{
+    char digits[10];
+    char fraction[9];
+    uint8_t length = 0;
+    uint8_t n, k;
+    bool negative = ((number < 0) != (unit < 0));
+    uint32_t value = (number < 0) ? -(uint32_t)number : (uint32_t)number;
+    uint32_t divider = (unit < 0) ? -(uint32_t)unit : (uint32_t)unit;
+    uint32_t remainder = 0;
+
+    if (size >= LCD_FORMAT_SIZE) size = LCD_FORMAT_SIZE - 1;
+    if (decimal > 9) decimal = 9;
+
+    // Integer part and remainder apart, only the remainder is scaled, so nothing
+    // overflows; the division is skipped for unit 1, and unit 0 counts as 1
+    if (divider == 0) divider = 1;
+    if (divider > 1) {
+        remainder = value % divider;
+        value /= divider;
+    }
+
+    // Each decimal is remainder * 10 / divider, the product as a sum kept below
+    // divider, as the remainder may take the 32 bits once multiplied
+    for (k = 0; k < decimal; k++) {
+        uint32_t scaled = 0;
+        fraction[k] = '0';
+        for (n = 0; n < 10; n++) {
+            scaled += remainder;
+            if (scaled >= divider) {
+                scaled -= divider;
+                fraction[k]++;
+            }
+        }
+        remainder = scaled;
+    }
+
+    // Rounded to the nearest, the carry goes through the decimals to the integer part
+    if ((divider > 1) && (remainder >= divider - remainder)) {
+        for (k = decimal; k > 0; k--) {
+            if (fraction[k - 1] < '9') {
+                fraction[k - 1]++;
+                break;
+            }
+            fraction[k - 1] = '0';
+        }
+        if (k == 0) value++;
+    }
+
+    // No sign for a result shown as zero
+    if (negative) {
+        negative = (value > 0);
+        for (k = 0; k < decimal; k++) negative |= (fraction[k] != '0');
+    }
+
+    n = _decimalDigits(digits, value);
+    if (negative) buffer[length++] = '-';
+    memcpy(buffer + length, digits, n);
+    length += n;
+    if (decimal > 0) {
+        buffer[length++] = '.';
+        memcpy(buffer + length, fraction, decimal);
+        length += decimal;
+    }
+
+    length = _pad(buffer, length, size, ' ');
+    return _overflow(buffer, length, size);
+}
+
+uint8_t htoa(char *buffer, uint32_t number, uint8_t size)
+{
+    static const char hexadecimal[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+    uint8_t length = 0;
+    int8_t shift = 28;
+
+    if (size >= LCD_FORMAT_SIZE) size = LCD_FORMAT_SIZE - 1;
+
+    // Skip the leading zeros, keep at least one digit
+    while ((shift > 0) && (((number >> shift) & 0x0F) == 0)) shift -= 4;
+    for (; shift >= 0; shift -= 4) buffer[length++] = hexadecimal[(number >> shift) & 0x0F];
+
+    length = _pad(buffer, length, size, '0');
+    return _overflow(buffer, length, size);
+}
+
+uint8_t btoa(char *buffer, uint16_t number, uint8_t size)
+{
+    if (size >= LCD_FORMAT_SIZE) size = LCD_FORMAT_SIZE - 1;
+
+    // Too small for a byte, or for the bits of number
+    if ((size < 8) || ((size < 16) && ((number >> size) > 0))) {
+        buffer[0] = '#';
+        buffer[1] = '\0';
+        return 1;
+    }
+
+    for (uint8_t i = size; i > 0; i--) {
+        buffer[i - 1] = '0' + (char)(number & 0x01);
+        number >>= 1;
+    }
+    buffer[size] = '\0';
+    return size;
+}
+
+uint8_t ttoa(char *buffer, uint32_t number, uint8_t size)
+{
+    const char *suffix;
+    uint8_t length;
+
+    if (size >= LCD_FORMAT_SIZE) size = LCD_FORMAT_SIZE - 1;
+
+    if (number < (uint32_t)1000) {
+        length = _decimalDigits(buffer, number);
+        suffix = "ms";
+    } else {
+        // Tenths of s, of mn or of h
+        if (number < (uint32_t)60000) {
+            number /= (uint32_t)100;
+            suffix = "s";
+        } else if (number < (uint32_t)3600000) {
+            number /= (uint32_t)6000;
+            suffix = "mn";
+        } else {
+            number /= (uint32_t)360000;
+            suffix = "h";
+        }
+        // At least 10 tenths, so two digits
+        length = _decimalDigits(buffer, number);
+        buffer[length] = buffer[length - 1];
+        buffer[length - 1] = '.';
+        length++;
+    }
+
+    // Width applies to the number, without the suffix
+    uint8_t width = strlen(suffix);
+    length = _pad(buffer, length, (size > width) ? size - width : 0, ' ');
+    strcpy(buffer + length, suffix);
+    return length + width;
+}
+
+// String versions, on top of the buffer versions
+
+String i32toa(int32_t number, int32_t unit, uint8_t decimal, uint8_t size)
+{
+    char buffer[LCD_FORMAT_SIZE];
+
+    i32toa(buffer, number, unit, decimal, size);
+    return buffer;
+}
+
+String htoa(uint32_t number, uint8_t size)
+{
+    char buffer[LCD_FORMAT_SIZE];
+
+    htoa(buffer, number, size);
+    return buffer;
+}
+
+String ttoa(uint32_t number, uint8_t size)
+{
+    char buffer[LCD_FORMAT_SIZE];
+
+    ttoa(buffer, number, size);
+    return buffer;
+}
+
+String btoa(uint16_t number, uint8_t size)
+{
+    char buffer[LCD_FORMAT_SIZE];
+
+    btoa(buffer, number, size);
+    return buffer;
+}
@@ -29,9 +29,119 @@
 #define LCD_UTILITIES_RELEASE 102
 int32_t cos32x100(int32_t degreesX100);
 int32_t sin32x100(int32_t degreesX100);
+
+///
+/// @brief  Binary angle units: a full turn is 65536 and wraps with uint16_t
+///
+#define LCD_ANGLE_TURN 65536L
+
+///
+/// @brief	Sine in Q15
+/// @param	angle binary angle, 16384 = 90 degrees
+/// @return	sin(angle) * 32768, from -32767 to 32767, within 2 LSB
+/// @note   Quarter-wave table with linear interpolation, see LCD_trig.h.
+/// @n      No division: one 16-bit multiplication.
+///
+int16_t sinQ15(uint16_t angle);
+
+///
+/// @brief	Cosine in Q15
+/// @param	angle binary angle, 16384 = 90 degrees
+/// @return	cos(angle) * 32768, from -32767 to 32767, within 2 LSB
+///
+int16_t cosQ15(uint16_t angle);
+
+///
+/// @brief	Angle of a vector
+/// @param	y y coordinate, y = r * sinQ15(angle)
+/// @param	x x coordinate, x = r * cosQ15(angle)
+/// @return	binary angle, 0 for (0, 0), within 0.01 degree
+/// @note   Octant symmetry and an interpolated table, one division.
+///
+uint16_t atan2Angle(int32_t y, int32_t x);
+
+///
+/// @brief	Integer square root
+/// @param	value number
+/// @return	floor(sqrt(value))
+/// @note   Shifts and subtractions only.
+///
+uint16_t isqrt32(uint32_t value);
 String utf2iso(String s);
+
+///
+/// @brief  Glyph for code points outside Latin-1 and the euro sign
+///
+#define LCD_UTF8_UNKNOWN '?'
+
+///
+/// @brief	Length of a UTF-8 sequence from its first byte
+/// @param	c first byte
+/// @return	2 to 4 for a lead byte, 1 for ASCII and for bytes that cannot start a sequence
+///
+uint8_t utf8Length(uint8_t c);
+
+///
+/// @brief	Decode the next character of a UTF-8 string into a glyph code
+/// @param	s string
+/// @param	length length of s, in bytes
+/// @param	index position in s, moved past the character
+/// @return	Latin-1 code, 0x80 for the euro sign, LCD_UTF8_UNKNOWN for other code points
+/// @note   Bytes that are not part of a valid sequence are returned as they are, so
+/// @n      Latin-1 strings, such as the result of utf2iso(), are still shown, unless
+/// @n      they happen to form valid UTF-8.
+///
+uint8_t utf8Next(const char *s, uint16_t length, uint16_t *index);
 String htoa(uint32_t number, uint8_t size=0);
 String btoa(uint16_t number, uint8_t size=8);
 String ttoa(uint32_t number, uint8_t size=0);
 String i32toa(int32_t number, int32_t unit=1, uint8_t decimal=0, uint8_t size=0);
+
+///
+/// @brief  Buffer size for the formatters below
+/// @note   Enough for any result, as size is limited to LCD_FORMAT_SIZE - 1.
+///
+#define LCD_FORMAT_SIZE 24
+
+///
+/// @brief	Format a fixed-point number into a buffer
+/// @param	buffer at least max(size, 21) + 1 characters, LCD_FORMAT_SIZE is enough
+/// @param	number value, divided by unit, any int32_t: the decimals are computed
+/// @n      from the remainder, without overflow
+/// @param	unit divider, rounded to the nearest
+/// @param	decimal number of decimals, 0 to 9
+/// @param	size minimum width, right-aligned with spaces, 0 = no padding
+/// @return	length of the string, "#" when it is wider than size
+/// @note   Integer only, reentrant, no allocation. The length goes to gTextLength():
+/// @code   myScreen.gTextLength(x, y, buffer, i32toa(buffer, temperature, 10, 1, 5));
+/// @endcode
+///
+uint8_t i32toa(char *buffer, int32_t number, int32_t unit=1, uint8_t decimal=0, uint8_t size=0);
+
+///
+/// @brief	Format a number in hexadecimal into a buffer
+/// @param	buffer at least max(size, 8) + 1 characters
+/// @param	number value
+/// @param	size width, padded with 0, 0 = no padding
+/// @return	length of the string, "#" when it is wider than size
+///
+uint8_t htoa(char *buffer, uint32_t number, uint8_t size=0);
+
+///
+/// @brief	Format a number in binary into a buffer
+/// @param	buffer at least size + 1 characters
+/// @param	number value
+/// @param	size width, padded with 0, 8 minimum
+/// @return	length of the string, "#" when size is below 8 or too small for number
+///
+uint8_t btoa(char *buffer, uint16_t number, uint8_t size=8);
+
+///
+/// @brief	Format a duration into a buffer
+/// @param	buffer at least max(size, 8) + 1 characters
+/// @param	number duration in ms, shown as ms, s, mn or h
+/// @param	size minimum width, right-aligned with spaces, 0 = no padding
+/// @return	length of the string
+///
+uint8_t ttoa(char *buffer, uint32_t number, uint8_t size=0);
 #endif
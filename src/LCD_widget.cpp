@@ -0,0 +1,528 @@
+// LCD_widget.cpp
+//
+// Retained widgets for LCD_screen_font based displays
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+// Library header
+#include "LCD_widget.h"
+
+#define WIDGET_VISIBLE      0x01
+#define WIDGET_ENABLED      0x02
+#define WIDGET_DIRTY        0x04    ///< whole widget to draw
+#define WIDGET_CHANGED      0x08    ///< content to draw
+#define WIDGET_TOUCHABLE    0x10
+#define WIDGET_PRESSED      0x20
+#define WIDGET_CHECKED      0x40
+
+// Space between the box of a check box and its text
+#define WIDGET_SPACE        4
+
+// Code
+LCD_widget::LCD_widget()
+{
+    _next       = NULL;
+    _panel      = NULL;
+    _x0 = _y0   = 0;
+    _dx = _dy   = 0;
+    _textColour = whiteColour;
+    _backColour = blackColour;
+    _font       = NULL;
+    _callback   = NULL;
+    _flags      = WIDGET_VISIBLE | WIDGET_ENABLED | WIDGET_DIRTY;
+}
+
+void LCD_widget::setArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    if ((x0 == _x0) && (y0 == _y0) && (dx == _dx) && (dy == _dy)) return;
+    // The widgets under the old area have to be drawn again, as with remove()
+    if ((_panel != NULL) && isVisible() && (_dx > 0) && (_dy > 0)) _panel->invalidate();
+    _x0 = x0;
+    _y0 = y0;
+    _dx = dx;
+    _dy = dy;
+    _change(WIDGET_DIRTY);
+}
+
+void LCD_widget::setColours(uint16_t textColour, uint16_t backColour)
+{
+    if ((textColour == _textColour) && (backColour == _backColour)) return;
+    _textColour = textColour;
+    _backColour = backColour;
+    _change(WIDGET_DIRTY);
+}
+
+void LCD_widget::setFont(const LCD_font *font)
+{
+    if (font == _font) return;
+    _font = font;
+    _change(WIDGET_DIRTY);
+}
+
+void LCD_widget::setVisible(bool flag)
+{
+    if (flag == isVisible()) return;
+    _flags ^= WIDGET_VISIBLE;
+    _change(WIDGET_DIRTY);
+}
+
+bool LCD_widget::isVisible()
+{
+    return (_flags & WIDGET_VISIBLE);
+}
+
+void LCD_widget::setEnabled(bool flag)
+{
+    if (flag == isEnabled()) return;
+    _flags ^= WIDGET_ENABLED;
+    _flags &= ~WIDGET_PRESSED;
+    _change(WIDGET_DIRTY);
+}
+
+bool LCD_widget::isEnabled()
+{
+    return (_flags & WIDGET_ENABLED);
+}
+
+void LCD_widget::setCallback(LCD_widgetFunction callback)
+{
+    _callback = callback;
+}
+
+void LCD_widget::invalidate()
+{
+    _change(WIDGET_DIRTY);
+}
+
+bool LCD_widget::contains(uint16_t x, uint16_t y)
+{
+    return ((x >= _x0) && (x < _x0 + _dx) && (y >= _y0) && (y < _y0 + _dy));
+}
+
+void LCD_widget::update(LCD_screen_font *screen, uint16_t backColour)
+{
+    if ((_flags & (WIDGET_DIRTY | WIDGET_CHANGED)) == 0) return;
+
+    if (_flags & WIDGET_VISIBLE) {
+        const LCD_font *font = screen->getFont();
+        if (_font != NULL) screen->setFont(_font);
+        _draw(screen, _flags & WIDGET_DIRTY);
+        screen->setFont(font);
+    } else if (_flags & WIDGET_DIRTY) {
+        // Hidden: the panel shows through
+        screen->dRectangle(_x0, _y0, _dx, _dy, backColour);
+    }
+    _flags &= ~(WIDGET_DIRTY | WIDGET_CHANGED);
+}
+
+bool LCD_widget::touch(uint8_t type, uint16_t x, uint16_t y)
+{
+    return false;
+}
+
+LCD_widget *LCD_widget::_hit(uint16_t x, uint16_t y)
+{
+    uint8_t flags = WIDGET_VISIBLE | WIDGET_ENABLED | WIDGET_TOUCHABLE;
+
+    return (((_flags & flags) == flags) && contains(x, y)) ? this : NULL;
+}
+
+void LCD_widget::_change(uint8_t flag)
+{
+    _flags |= flag;
+}
+
+uint16_t LCD_widget::_colour()
+{
+    return (_flags & WIDGET_ENABLED) ? _textColour : grayColour;
+}
+
+// One pixel frame, drawn as 4 fills
+void LCD_widget::_frame(LCD_screen_font *screen, uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour)
+{
+    screen->dRectangle(x0, y0, dx, 1, colour);
+    screen->dRectangle(x0, y0 + dy - 1, dx, 1, colour);
+    screen->dRectangle(x0, y0 + 1, 1, dy - 2, colour);
+    screen->dRectangle(x0 + dx - 1, y0 + 1, 1, dy - 2, colour);
+}
+
+// Solid text in an area: only the bands around the text are filled
+// The text is cut to the characters that fit in the width, and not drawn if
+// the font is taller than the area.
+void LCD_widget::_drawText(LCD_screen_font *screen, const char *text, uint8_t align,
+                           uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                           uint16_t textColour, uint16_t backColour)
+{
+    uint16_t height = screen->fontSizeY();
+
+    if (height > dy) {
+        screen->dRectangle(x0, y0, dx, dy, backColour);
+        return;
+    }
+
+    uint16_t width;
+    uint16_t length = screen->textFit(text, dx, width);
+    uint16_t x = x0, y = y0 + (dy - height) / 2;
+
+    if (align == WIDGET_CENTRE) x += (dx - width) / 2;
+    else if (align == WIDGET_RIGHT) x += dx - width;
+
+    if (y > y0) screen->dRectangle(x0, y0, dx, y - y0, backColour);
+    if (y + height < y0 + dy) screen->dRectangle(x0, y + height, dx, y0 + dy - y - height, backColour);
+    if (x > x0) screen->dRectangle(x0, y, x - x0, height, backColour);
+    if (x + width < x0 + dx) screen->dRectangle(x + width, y, x0 + dx - x - width, height, backColour);
+    if (length > 0) screen->gTextLength(x, y, text, length, textColour, backColour);
+}
+
+// Panel
+LCD_panel::LCD_panel()
+{
+    _screen   = NULL;
+    _first    = NULL;
+    _captured = NULL;
+}
+
+void LCD_panel::begin(LCD_screen_font *screen, uint16_t backColour)
+{
+    _screen = screen;
+    begin(0, 0, screen->screenSizeX(), screen->screenSizeY(), backColour);
+}
+
+void LCD_panel::begin(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t backColour)
+{
+    setArea(x0, y0, dx, dy);
+    _backColour = backColour;
+    _captured = NULL;
+    invalidate();
+}
+
+void LCD_panel::add(LCD_widget *widget)
+{
+    LCD_widget **last = &_first;
+
+    while (*last != NULL) {
+        if (*last == widget) return;
+        last = &(*last)->_next;
+    }
+    *last = widget;
+    widget->_next = NULL;
+    widget->_panel = this;
+    widget->invalidate();
+}
+
+void LCD_panel::remove(LCD_widget *widget)
+{
+    LCD_widget **item = &_first;
+
+    while (*item != NULL) {
+        if (*item == widget) {
+            *item = widget->_next;
+            widget->_next = NULL;
+            widget->_panel = NULL;
+            if (_captured == widget) _captured = NULL;
+            // The widgets under it have to be drawn again
+            invalidate();
+            return;
+        }
+        item = &(*item)->_next;
+    }
+}
+
+void LCD_panel::update()
+{
+    if (_screen == NULL) return;
+
+    bool penSolid  = _screen->isPenSolid();
+    bool fontSolid = _screen->isFontSolid();
+    _screen->setPenSolid(true);
+    _screen->setFontSolid(true);
+    update(_screen, _backColour);
+    _screen->setPenSolid(penSolid);
+    _screen->setFontSolid(fontSolid);
+}
+
+void LCD_panel::update(LCD_screen_font *screen, uint16_t backColour)
+{
+    if ((_flags & WIDGET_VISIBLE) == 0) {
+        LCD_widget::update(screen, backColour);
+        return;
+    }
+    if (_flags & WIDGET_DIRTY) _draw(screen, true);
+    _flags &= ~(WIDGET_DIRTY | WIDGET_CHANGED);
+
+    for (LCD_widget *widget = _first; widget != NULL; widget = widget->_next) widget->update(screen, _backColour);
+}
+
+bool LCD_panel::touch(const LCD_touchEvent &event)
+{
+    return touch(event.type, event.x, event.y);
+}
+
+bool LCD_panel::touch(uint8_t type, uint16_t x, uint16_t y)
+{
+    // The widget under the down event gets the whole gesture
+    if (type == TOUCH_DOWN) _captured = _hit(x, y);
+    if (_captured == NULL) return false;
+
+    bool result = _captured->touch(type, x, y);
+    if (type == TOUCH_UP) _captured = NULL;
+    return result;
+}
+
+// Background, then all the visible widgets
+void LCD_panel::_draw(LCD_screen_font *screen, bool whole)
+{
+    screen->dRectangle(_x0, _y0, _dx, _dy, _backColour);
+    for (LCD_widget *widget = _first; widget != NULL; widget = widget->_next) {
+        if (widget->_flags & WIDGET_VISIBLE) widget->_flags |= WIDGET_DIRTY;
+        else widget->_flags &= ~(WIDGET_DIRTY | WIDGET_CHANGED);
+    }
+}
+
+// Topmost widget, the last one attached, down to the widgets of inner panels
+LCD_widget *LCD_panel::_hit(uint16_t x, uint16_t y)
+{
+    LCD_widget *result = NULL;
+
+    if (((_flags & (WIDGET_VISIBLE | WIDGET_ENABLED)) != (WIDGET_VISIBLE | WIDGET_ENABLED)) || !contains(x, y)) return NULL;
+    for (LCD_widget *widget = _first; widget != NULL; widget = widget->_next) {
+        LCD_widget *hit = widget->_hit(x, y);
+        if (hit != NULL) result = hit;
+    }
+    return result;
+}
+
+// Label
+LCD_label::LCD_label()
+{
+    _text  = NULL;
+    _align = WIDGET_LEFT;
+}
+
+void LCD_label::begin(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const char *text, uint8_t align)
+{
+    setArea(x0, y0, dx, dy);
+    _text  = text;
+    _align = align;
+    invalidate();
+}
+
+void LCD_label::setText(const char *text)
+{
+    if (text == _text) return;
+    _text = text;
+    _change(WIDGET_DIRTY);
+}
+
+void LCD_label::_draw(LCD_screen_font *screen, bool whole)
+{
+    _drawText(screen, (_text != NULL) ? _text : "", _align, _x0, _y0, _dx, _dy, _colour(), _backColour);
+}
+
+// Button
+LCD_button::LCD_button()
+{
+    _align = WIDGET_CENTRE;
+}
+
+void LCD_button::begin(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const char *text)
+{
+    LCD_label::begin(x0, y0, dx, dy, text, WIDGET_CENTRE);
+    _flags |= WIDGET_TOUCHABLE;
+}
+
+bool LCD_button::isPressed()
+{
+    return (_flags & WIDGET_PRESSED);
+}
+
+bool LCD_button::touch(uint8_t type, uint16_t x, uint16_t y)
+{
+    if (!isEnabled()) return false;
+
+    bool inside  = contains(x, y);
+    bool pressed = isPressed();
+    bool fire    = false;
+
+    if (type == TOUCH_DOWN) {
+        pressed = inside;
+    } else if (type == TOUCH_MOVE) {
+        pressed = inside;
+    } else if (type == TOUCH_UP) {
+        fire = (pressed && inside);
+        pressed = false;
+    }
+    if (pressed != isPressed()) {
+        _flags ^= WIDGET_PRESSED;
+        _change(WIDGET_DIRTY);
+    }
+    if (fire && (_callback != NULL)) _callback(this);
+    return (fire || (_flags & WIDGET_DIRTY));
+}
+
+void LCD_button::_draw(LCD_screen_font *screen, bool whole)
+{
+    uint16_t textColour = _colour();
+    uint16_t backColour = _backColour;
+
+    // Inverted while pressed
+    if (isPressed()) {
+        textColour = _backColour;
+        backColour = _colour();
+    }
+    _frame(screen, _x0, _y0, _dx, _dy, _colour());
+    _drawText(screen, (_text != NULL) ? _text : "", WIDGET_CENTRE, _x0 + 1, _y0 + 1, _dx - 2, _dy - 2, textColour, backColour);
+}
+
+// Progress bar
+LCD_progress::LCD_progress()
+{
+    _value   = 0;
+    _maximum = 100;
+    _drawn   = 0;
+}
+
+void LCD_progress::begin(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t maximum)
+{
+    setArea(x0, y0, dx, dy);
+    _maximum = max(maximum, 1);
+    _value   = 0;
+    invalidate();
+}
+
+void LCD_progress::setValue(uint16_t value)
+{
+    _value = min(value, _maximum);
+    // Only a new length of the bar is worth drawing
+    if (_length() != _drawn) _change(WIDGET_CHANGED);
+}
+
+uint16_t LCD_progress::getValue()
+{
+    return _value;
+}
+
+// Length of the bar inside the frame, pixels
+uint16_t LCD_progress::_length()
+{
+    return (uint32_t)_value * (_dx - 2) / _maximum;
+}
+
+void LCD_progress::_draw(LCD_screen_font *screen, bool whole)
+{
+    uint16_t length = _length();
+    uint16_t x = _x0 + 1, y = _y0 + 1, dy = _dy - 2;
+
+    if (whole) {
+        _frame(screen, _x0, _y0, _dx, _dy, _colour());
+        if (length > 0) screen->dRectangle(x, y, length, dy, _colour());
+        if (length < _dx - 2) screen->dRectangle(x + length, y, _dx - 2 - length, dy, _backColour);
+    } else if (length > _drawn) {
+        screen->dRectangle(x + _drawn, y, length - _drawn, dy, _colour());
+    } else if (length < _drawn) {
+        screen->dRectangle(x + length, y, _drawn - length, dy, _backColour);
+    }
+    _drawn = length;
+}
+
+// Numeric field
+LCD_numeric::LCD_numeric()
+{
+    _value   = 0;
+    _unit    = 1;
+    _decimal = 0;
+}
+
+void LCD_numeric::begin(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, int32_t unit, uint8_t decimal)
+{
+    setArea(x0, y0, dx, dy);
+    _unit    = unit;
+    _decimal = decimal;
+    invalidate();
+}
+
+void LCD_numeric::setValue(int32_t value)
+{
+    if (value == _value) return;
+    _value = value;
+    _change(WIDGET_CHANGED);
+}
+
+int32_t LCD_numeric::getValue()
+{
+    return _value;
+}
+
+void LCD_numeric::_draw(LCD_screen_font *screen, bool whole)
+{
+    char text[LCD_FORMAT_SIZE];
+
+    i32toa(text, _value, _unit, _decimal);
+    _drawText(screen, text, WIDGET_RIGHT, _x0, _y0, _dx, _dy, _colour(), _backColour);
+}
+
+// Check box
+LCD_checkbox::LCD_checkbox()
+{
+}
+
+void LCD_checkbox::begin(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const char *text, bool checked)
+{
+    LCD_label::begin(x0, y0, dx, dy, text, WIDGET_LEFT);
+    _flags |= WIDGET_TOUCHABLE;
+    if (checked) _flags |= WIDGET_CHECKED;
+    else _flags &= ~WIDGET_CHECKED;
+}
+
+void LCD_checkbox::setChecked(bool flag)
+{
+    if (flag == isChecked()) return;
+    _flags ^= WIDGET_CHECKED;
+    _change(WIDGET_CHANGED);
+}
+
+bool LCD_checkbox::isChecked()
+{
+    return (_flags & WIDGET_CHECKED);
+}
+
+// Toggled by an up event inside, after a down event inside
+bool LCD_checkbox::touch(uint8_t type, uint16_t x, uint16_t y)
+{
+    if (!isEnabled()) return false;
+
+    if (type == TOUCH_DOWN) {
+        _flags |= WIDGET_PRESSED;
+    } else if (type == TOUCH_UP) {
+        bool toggle = (_flags & WIDGET_PRESSED) && contains(x, y);
+        _flags &= ~WIDGET_PRESSED;
+        if (toggle) {
+            setChecked(!isChecked());
+            if (_callback != NULL) _callback(this);
+            return true;
+        }
+    }
+    return false;
+}
+
+void LCD_checkbox::_draw(LCD_screen_font *screen, bool whole)
+{
+    // Square box of the height of the font, at the left
+    uint16_t side = min((uint16_t)screen->fontSizeY(), _dy);
+    uint16_t y = _y0 + (_dy - side) / 2;
+
+    if (whole) {
+        if (y > _y0) screen->dRectangle(_x0, _y0, side + WIDGET_SPACE, y - _y0, _backColour);
+        if (y + side < _y0 + _dy) screen->dRectangle(_x0, y + side, side + WIDGET_SPACE, _y0 + _dy - y - side, _backColour);
+        screen->dRectangle(_x0 + side, y, WIDGET_SPACE, side, _backColour);
+        _frame(screen, _x0, y, side, side, _colour());
+        screen->dRectangle(_x0 + 1, y + 1, side - 2, side - 2, _backColour);
+        _drawText(screen, (_text != NULL) ? _text : "", WIDGET_LEFT,
+                  _x0 + side + WIDGET_SPACE, _y0, _dx - side - WIDGET_SPACE, _dy, _colour(), _backColour);
+    }
+    // The mark, inside a one pixel margin
+    screen->dRectangle(_x0 + 2, y + 2, side - 4, side - 4, isChecked() ? _colour() : _backColour);
+}
@@ -0,0 +1,309 @@
+// LCD_widget.h
+//
+// Retained widgets for LCD_screen_font based displays
+//
+// Widgets are statically allocated by the sketch and attached to a panel,
+// which can itself be attached to another panel. A widget keeps its
+// properties and only records a change when a property is set to a new value;
+// the panel then redraws the changed widgets on update(), and only them.
+// Two levels of change are kept:
+// * dirty: the whole widget is drawn again, as after a move or a new text,
+// * changed: only the content changes, as the bar of a progress bar or the
+//   mark of a check box, and the widget draws the difference.
+//
+// Drawing uses the solid fills and the text windows of the screen: a text is
+// drawn solid, and only the bands around it are filled.
+//
+// Touch events, see LCD_touch.h, go to the root panel. A down event selects
+// the topmost touchable widget under the point, which then receives the move
+// and up events, even outside its area.
+//
+// https://github.com/Andy4495/Kentec_35_Parallel
+// This version continues to be licensed under CC BY-NC-SA 3.0 for hobbyist and personal usage.
+// See LICENSE file at above github repository
+//
+
+#include "Energia.h"
+
+#ifndef LCD_WIDGET_RELEASE
+///
+/// @brief	Library release number
+///
+#define LCD_WIDGET_RELEASE 100
+
+#include "LCD_screen_font.h"
+#include "LCD_touch.h"
+
+///
+/// @brief	Text alignments
+///
+enum {WIDGET_LEFT = 0, WIDGET_CENTRE = 1, WIDGET_RIGHT = 2};
+
+class LCD_widget;
+class LCD_panel;
+
+///
+/// @brief      Widget callback
+/// @details    Called when a button is released or a check box toggled.
+///
+typedef void (*LCD_widgetFunction)(LCD_widget *widget);
+
+///
+/// @brief      Base of all widgets: area, colours, font and state
+///
+class LCD_widget {
+public:
+
+    ///
+    /// @brief	Constructor
+    ///
+    LCD_widget();
+
+    ///
+    /// @brief	Move or resize the widget
+    /// @note   A visible widget attached to a panel invalidates the panel,
+    ///         so the old area is drawn again.
+    ///
+    void setArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+    ///
+    /// @brief	Set the colours
+    /// @param	textColour text and frame
+    /// @param	backColour background
+    ///
+    void setColours(uint16_t textColour, uint16_t backColour);
+
+    ///
+    /// @brief	Set the font of the widget
+    /// @param	font the font, NULL for the font of the screen
+    ///
+    void setFont(const LCD_font *font);
+
+    ///
+    /// @brief	Show or hide the widget, a hidden widget is cleared by its panel
+    ///
+    void setVisible(bool flag = true);
+    bool isVisible();
+
+    ///
+    /// @brief	Enable or disable the widget, a disabled widget is grey and ignores touch
+    ///
+    void setEnabled(bool flag = true);
+    bool isEnabled();
+
+    ///
+    /// @brief	Set the callback
+    ///
+    void setCallback(LCD_widgetFunction callback);
+
+    ///
+    /// @brief	Draw the whole widget again on the next update
+    ///
+    void invalidate();
+
+    ///
+    /// @brief	Whether the point is in the area of the widget
+    ///
+    bool contains(uint16_t x, uint16_t y);
+
+    ///
+    /// @brief	Redraw the widget if it has changed
+    /// @param	screen the screen
+    /// @param	backColour colour of the panel, to clear a hidden widget
+    ///
+    virtual void update(LCD_screen_font *screen, uint16_t backColour);
+
+    ///
+    /// @brief	Handle a touch event
+    /// @param	type TOUCH_DOWN, TOUCH_MOVE or TOUCH_UP
+    /// @param	x screen x
+    /// @param	y screen y
+    /// @return	true if the event changed the widget
+    ///
+    virtual bool touch(uint8_t type, uint16_t x, uint16_t y);
+
+protected:
+    friend class LCD_panel;
+
+    LCD_widget *_next;
+    LCD_panel *_panel;
+    uint16_t _x0, _y0, _dx, _dy;
+    uint16_t _textColour, _backColour;
+    const LCD_font *_font;
+    LCD_widgetFunction _callback;
+    uint8_t _flags;
+
+    virtual void _draw(LCD_screen_font *screen, bool whole) =0;
+    virtual LCD_widget *_hit(uint16_t x, uint16_t y);
+    void _change(uint8_t flag);
+    uint16_t _colour();
+    void _frame(LCD_screen_font *screen, uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour);
+    void _drawText(LCD_screen_font *screen, const char *text, uint8_t align,
+                   uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                   uint16_t textColour, uint16_t backColour);
+};
+
+///
+/// @brief      Container of widgets, the root panel receives the touch events
+///
+class LCD_panel : public LCD_widget {
+public:
+    LCD_panel();
+
+    ///
+    /// @brief	Root panel, covering the whole screen
+    /// @param	screen pointer to the screen
+    /// @param	backColour background
+    ///
+    void begin(LCD_screen_font *screen, uint16_t backColour = blackColour);
+
+    ///
+    /// @brief	Panel inside another panel
+    ///
+    void begin(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t backColour = blackColour);
+
+    ///
+    /// @brief	Attach a widget, drawn on top of the previous ones
+    ///
+    void add(LCD_widget *widget);
+
+    ///
+    /// @brief	Detach a widget, the panel is drawn again
+    ///
+    void remove(LCD_widget *widget);
+
+    ///
+    /// @brief	Redraw the changed widgets of the root panel
+    ///
+    void update();
+    virtual void update(LCD_screen_font *screen, uint16_t backColour);
+
+    ///
+    /// @brief	Send a touch event to the widgets of the root panel
+    /// @return	true if a widget changed
+    ///
+    bool touch(const LCD_touchEvent &event);
+    virtual bool touch(uint8_t type, uint16_t x, uint16_t y);
+
+protected:
+    LCD_screen_font *_screen;
+    LCD_widget *_first;
+    LCD_widget *_captured;
+
+    virtual void _draw(LCD_screen_font *screen, bool whole);
+    virtual LCD_widget *_hit(uint16_t x, uint16_t y);
+};
+
+///
+/// @brief      Text
+///
+class LCD_label : public LCD_widget {
+public:
+    LCD_label();
+
+    ///
+    /// @param	text the text, kept as a pointer
+    /// @param	align WIDGET_LEFT, WIDGET_CENTRE or WIDGET_RIGHT
+    ///
+    void begin(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const char *text, uint8_t align = WIDGET_LEFT);
+
+    ///
+    /// @brief	Set the text
+    /// @note   The text is kept as a pointer: a new pointer redraws the label,
+    /// @n      a text changed in the same buffer needs invalidate().
+    ///
+    void setText(const char *text);
+
+protected:
+    const char *_text;
+    uint8_t _align;
+
+    virtual void _draw(LCD_screen_font *screen, bool whole);
+};
+
+///
+/// @brief      Button with a frame, inverted while pressed
+///
+class LCD_button : public LCD_label {
+public:
+    LCD_button();
+    void begin(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const char *text);
+
+    ///
+    /// @brief	Whether the button is pressed
+    ///
+    bool isPressed();
+
+    ///
+    /// @brief	Press on down, follow the point, call the callback on up inside
+    ///
+    virtual bool touch(uint8_t type, uint16_t x, uint16_t y);
+
+protected:
+    virtual void _draw(LCD_screen_font *screen, bool whole);
+};
+
+///
+/// @brief      Horizontal bar, only the difference is drawn
+///
+class LCD_progress : public LCD_widget {
+public:
+    LCD_progress();
+
+    ///
+    /// @param	maximum value of a full bar
+    ///
+    void begin(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t maximum = 100);
+    void setValue(uint16_t value);
+    uint16_t getValue();
+
+protected:
+    uint16_t _value, _maximum;
+    uint16_t _drawn;
+
+    uint16_t _length();
+    virtual void _draw(LCD_screen_font *screen, bool whole);
+};
+
+///
+/// @brief      Number, formatted with i32toa()
+///
+class LCD_numeric : public LCD_widget {
+public:
+    LCD_numeric();
+
+    ///
+    /// @param	unit value of 1, as for i32toa()
+    /// @param	decimal number of decimals
+    ///
+    void begin(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, int32_t unit = 1, uint8_t decimal = 0);
+
+    ///
+    /// @brief	Set the value, the field is only drawn again when it changes
+    ///
+    void setValue(int32_t value);
+    int32_t getValue();
+
+protected:
+    int32_t _value, _unit;
+    uint8_t _decimal;
+
+    virtual void _draw(LCD_screen_font *screen, bool whole);
+};
+
+///
+/// @brief      Check box with a text, toggled by a tap
+///
+class LCD_checkbox : public LCD_label {
+public:
+    LCD_checkbox();
+    void begin(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const char *text, bool checked = false);
+    void setChecked(bool flag = true);
+    bool isChecked();
+    virtual bool touch(uint8_t type, uint16_t x, uint16_t y);
+
+protected:
+    virtual void _draw(LCD_screen_font *screen, bool whole);
+};
+
+#endif
@@ -105,6 +105,21 @@
 /// @{
 
 #define TOUCH_TRIM  0x10 ///< Touch threshold
+#define TOUCH_STABLE   8 ///< Largest difference between two readings of an axis
+
+// Touch sampler phases, one per pollTouch()
+#define TOUCH_START     0   ///< Panel discharge, MSP432 only
+#define TOUCH_X_SETUP   1
+#define TOUCH_X_FIRST   2
+#define TOUCH_X_SECOND  3
+#define TOUCH_Y_SETUP   4
+#define TOUCH_Y_FIRST   5
+#define TOUCH_Y_SECOND  6
+#define TOUCH_Z_SETUP   7
+#define TOUCH_Z_FIRST   8   ///< XN then YP, twice
+#define TOUCH_Z_SECOND  9
+#define TOUCH_Z_THIRD   10
+#define TOUCH_Z_FOURTH  11
 
 
 /// @}
@@ -154,6 +169,16 @@ Screen_K35_Parallel::Screen_K35_Parallel(uint8_t interface_board, uint8_t touch_
     TOUCH_XN              = 12;
     TOUCH_YN              = 11;
     _touch_feature        = touch_feature;
+    _touchPhase           = TOUCH_START;
+    _touchRetry           = 0;
+    _touchUnstable        = false;
+    _touchTime            = 0;
+    _touchA = _touchC     = 0;
+    _touchRawX = _touchRawY = 0;
+    _touchX = _touchY = _touchZ = 0;
+    _touchCount = _touchRead = 0;
+    _touchInterrupt       = false;
+    setTouchTiming();
 #ifdef F5529_DIRECT_IO
     out3 = (volatile uint8_t *)(P3_BASE+OFS_P3OUT);
     out2 = (volatile uint8_t *)(P2_BASE+OFS_P2OUT);
@@ -324,31 +349,20 @@ void Screen_K35_Parallel::begin()
     setFontSize(0);
 
     // Touch
-    // The call to _getRawTouch() caused the code to hang when compied with MSP432
-    // The SPI version of the board also sometimes hangs on this call
-    // Therefore, comment out the code for now
-/*
-    if (_touch_feature == TOUCH_ENABLED) {
-      uint16_t x0, y0, z0;
-      _getRawTouch(x0, y0, z0);
-    }
-*/
+    // The former blocking _getRawTouch() hung on MSP432 and was not called here.
+    // The sampler is now run by pollTouch(), with a bounded number of retries.
+    _touchPhase = TOUCH_START;
+    _touchRetry = 0;
 
     // Touch calibration
     _touchTrim = TOUCH_TRIM;
 
 #if (ANALOG_RESOLUTION == 4095)
 #   warning ANALOG_RESOLUTION == 4095
-    _touchXmin = 3077;
-    _touchXmax = 881;
-    _touchYmin = 3354;
-    _touchYmax = 639;
+    _setTouchRange(3077, 881, 3354, 639);
 #elif (ANALOG_RESOLUTION == 1023)
 #   warning ANALOG_RESOLUTION == 1023
-    _touchXmin = 837;
-    _touchXmax = 160;
-    _touchYmin = 898;
-    _touchYmax = 114;
+    _setTouchRange(837, 160, 898, 114);
 #else
 #error Wrong
 #endif
@@ -372,11 +386,24 @@ void Screen_K35_Parallel::begin()
     clear();
 }
 
-String Screen_K35_Parallel::WhoAmI()
+const char *Screen_K35_Parallel::WhoAmI()
 {
     return "Kentec 3.5\" Parallel screen";
 }
 
+// The gate scan start register selects the GRAM row shown on the first gate line.
+// Gate lines run along y in orientations 1 and 3, along x in orientations 0 and 2,
+// and GRAM rows are addressed in reverse in orientations 1 and 2.
+bool Screen_K35_Parallel::setScroll(uint16_t offset, bool vertical)
+{
+    if (vertical != ((_orientation == 1) || (_orientation == 3))) return false;
+
+    offset %= K35_HEIGHT;
+    if ((_orientation == 1) || (_orientation == 2)) offset = (K35_HEIGHT - offset) % K35_HEIGHT;
+    _writeRegister(SSD2119_GATE_SCAN_START_REG, offset);
+    return true;
+}
+
 void Screen_K35_Parallel::_setOrientation(uint8_t orientation)
 {
     // default = 0x6830 = 0x68 <<8 + 0b00110000
@@ -938,104 +965,208 @@ void Screen_K35_Parallel::_fastFill(uint16_t x1, uint16_t y1, uint16_t x2, uint1
 }
 
 // Touch
-void Screen_K35_Parallel::_getRawTouch(uint16_t &x0, uint16_t &y0, uint16_t &z0)
+// --- 2015-08-04 _getRawTouch revised entirely
+// Tested against MSP432, F5529 and LM4F/TM4C
+// However, the calibrateTouch() may throw wrong results
+//
+// Each reading is now one phase of pollTouch(), with the settle time between phases
+// measured instead of waited for. A cycle takes two readings per axis and starts again
+// when they differ, at most _touchRetries times.
+void Screen_K35_Parallel::setTouchTiming(uint16_t settle, uint8_t retries)
 {
-    // --- 2015-08-04 _getRawTouch revised entirely
-    // Tested against MSP432, F5529 and LM4F/TM4C
-    // However, the calibrateTouch() may throw wrong results
-    //
-    int16_t a, b, c, d;
-    bool flag;
+    _touchSettle  = settle;
+    _touchRetries = retries;
+}
+
+void Screen_K35_Parallel::setTouchInterrupt(bool flag)
+{
+    _touchInterrupt = flag;
+}
+
+bool Screen_K35_Parallel::pollTouch()
+{
+    int16_t value;
+    bool flagPublished = false;
 
+    if ((_touchSettle > 0) && (micros() - _touchTime < _touchSettle)) return false;
+
+    switch (_touchPhase) {
+        case TOUCH_START:
+            // MSP432: the panel is discharged first, other MCUs start with x
 #if defined(__MSP432P401R__)
-    pinMode(TOUCH_YP, OUTPUT);
-    pinMode(TOUCH_YN, OUTPUT);
-    pinMode(TOUCH_XP, OUTPUT);
-    pinMode(TOUCH_XN, OUTPUT);
-    digitalWrite(TOUCH_YP, LOW);
-    digitalWrite(TOUCH_YN, LOW);
-    digitalWrite(TOUCH_XP, LOW);
-    digitalWrite(TOUCH_XN, LOW);
-
-    delayMicroseconds(1000); // delay(1);
+            pinMode(TOUCH_YP, OUTPUT);
+            pinMode(TOUCH_YN, OUTPUT);
+            pinMode(TOUCH_XP, OUTPUT);
+            pinMode(TOUCH_XN, OUTPUT);
+            digitalWrite(TOUCH_YP, LOW);
+            digitalWrite(TOUCH_YN, LOW);
+            digitalWrite(TOUCH_XP, LOW);
+            digitalWrite(TOUCH_XN, LOW);
+            _touchPhase = TOUCH_X_SETUP;
+            break;
 #endif
 
+        case TOUCH_X_SETUP:
+            // Read x
+            // xp = +Vref
+            // xn = ground
+            // yp = measure
+            // yn = open
+            pinMode(TOUCH_YP, INPUT);
+            pinMode(TOUCH_YN, INPUT);
+
+            pinMode(TOUCH_XP, OUTPUT);
+            pinMode(TOUCH_XN, OUTPUT);
+            digitalWrite(TOUCH_XP, HIGH);
+            digitalWrite(TOUCH_XN, LOW);
+            _touchUnstable = false;
+            _touchPhase = TOUCH_X_FIRST;
+            break;
+
+        case TOUCH_X_FIRST:
+            _touchA = analogRead(TOUCH_YP);
+            _touchPhase = TOUCH_X_SECOND;
+            break;
+
+        case TOUCH_X_SECOND:
+            value = analogRead(TOUCH_YP);
+            _touchUnstable |= (absDiff(_touchA, value) > TOUCH_STABLE);
+            _touchRawX = ANALOG_RESOLUTION - _touchA;
+            _touchPhase = TOUCH_Y_SETUP;
+            break;
+
+        case TOUCH_Y_SETUP:
+            // Read y
+            // xp = measure
+            // xn = open
+            // yp = +Vref
+            // yn = ground
+            pinMode(TOUCH_XP, INPUT);
+            pinMode(TOUCH_XN, INPUT);
+
+            pinMode(TOUCH_YP, OUTPUT);
+            pinMode(TOUCH_YN, OUTPUT);
+            digitalWrite(TOUCH_YP, HIGH);
+            digitalWrite(TOUCH_YN, LOW);
+            _touchPhase = TOUCH_Y_FIRST;
+            break;
+
+        case TOUCH_Y_FIRST:
+            _touchA = analogRead(TOUCH_XP);
+            _touchPhase = TOUCH_Y_SECOND;
+            break;
+
+        case TOUCH_Y_SECOND:
+            value = analogRead(TOUCH_XP);
+            _touchUnstable |= (absDiff(_touchA, value) > TOUCH_STABLE);
+            _touchRawY = ANALOG_RESOLUTION - _touchA;
+            _touchPhase = TOUCH_Z_SETUP;
+            break;
+
+        case TOUCH_Z_SETUP:
+            // Read z
+            // xp = ground
+            // xn = measure
+            // yp = measure
+            // yn = +Vref
+            pinMode(TOUCH_XP, OUTPUT);
+            pinMode(TOUCH_YN, OUTPUT);
+            digitalWrite(TOUCH_XP, LOW);
+            digitalWrite(TOUCH_YN, HIGH);
+
+            pinMode(TOUCH_XN, INPUT);
+            pinMode(TOUCH_YP, INPUT);
+            _touchPhase = TOUCH_Z_FIRST;
+            break;
+
+        case TOUCH_Z_FIRST:
+            _touchA = analogRead(TOUCH_XN);
+            _touchPhase = TOUCH_Z_SECOND;
+            break;
+
+        case TOUCH_Z_SECOND:
+            _touchC = analogRead(TOUCH_YP);
+            _touchPhase = TOUCH_Z_THIRD;
+            break;
+
+        case TOUCH_Z_THIRD:
+            value = analogRead(TOUCH_XN);
+            _touchUnstable |= (absDiff(_touchA, value) > TOUCH_STABLE);
+            _touchPhase = TOUCH_Z_FOURTH;
+            break;
+
+        case TOUCH_Z_FOURTH:
+        default:
+            value = analogRead(TOUCH_YP);
+            _touchUnstable |= (absDiff(_touchC, value) > TOUCH_STABLE);
+
+            if (_touchUnstable && (_touchRetry < _touchRetries)) {
+                _touchRetry++;
+                _touchPhase = TOUCH_X_SETUP;
+                break;
+            }
+            // z0 = (ANALOG_RESOLUTION - (c-a));
+            // Because a = TOUCH_XN non analog, remove a
+            // No stable reading after the retries: no touch
+            _publishTouch(_touchUnstable ? 0 : ANALOG_RESOLUTION - _touchC);
+            flagPublished = true;
+            _touchRetry = 0;
+            _touchPhase = TOUCH_START;
+            break;
+    }
+    _touchTime = micros();
+    return flagPublished;
+}
+
+void Screen_K35_Parallel::_publishTouch(uint16_t z0)
+{
+    _touchX = _touchRawX;
+    _touchY = _touchRawY;
+    _touchZ = z0;
+    // Written last: a reader checks it did not change while copying
+    _touchCount++;
+}
+
+bool Screen_K35_Parallel::getTouchSample(uint16_t &x0, uint16_t &y0, uint16_t &z0)
+{
+    uint8_t count;
+
     do {
-        flag = false;
-
-        // Read x
-        // xp = +Vref
-        // xn = ground
-        // yp = measure
-        // yn = open
-
-        pinMode(TOUCH_YP, INPUT);
-        pinMode(TOUCH_YN, INPUT);
-
-        pinMode(TOUCH_XP, OUTPUT);
-        pinMode(TOUCH_XN, OUTPUT);
-        digitalWrite(TOUCH_XP, HIGH);
-        digitalWrite(TOUCH_XN, LOW);
-
-        delayMicroseconds(1000); // delay(1);
-        a = analogRead(TOUCH_YP);
-        delayMicroseconds(1000); // delay(1);
-        b = analogRead(TOUCH_YP);
-
-        flag |= (absDiff(a, b) > 8);
-        x0  = ANALOG_RESOLUTION - a;
-
-        // Read y
-        // xp = measure
-        // xn = open
-        // yp = +Vref
-        // yn = ground
-
-        pinMode(TOUCH_XP, INPUT);
-        pinMode(TOUCH_XN, INPUT);
-
-        pinMode(TOUCH_YP, OUTPUT);
-        pinMode(TOUCH_YN, OUTPUT);
-        digitalWrite(TOUCH_YP, HIGH);
-        digitalWrite(TOUCH_YN, LOW);
-
-        delayMicroseconds(1000); // delay(1);
-        c = analogRead(TOUCH_XP);
-        delayMicroseconds(1000); // delay(1);
-        d = analogRead(TOUCH_XP);
-
-        flag |= (absDiff(c, d) > 8);
-        y0  = ANALOG_RESOLUTION - c;
-
-        // Read z
-        // xp = ground
-        // xn = measure
-        // yp = measure
-        // yn = +Vref
-        pinMode(TOUCH_XP, OUTPUT);
-        pinMode(TOUCH_YN, OUTPUT);
-        digitalWrite(TOUCH_XP, LOW);
-        digitalWrite(TOUCH_YN, HIGH);
-
-        pinMode(TOUCH_XN, INPUT);
-        pinMode(TOUCH_YP, INPUT);
-
-        delayMicroseconds(1000); // delay(1);
-        a = analogRead(TOUCH_XN);
-        delayMicroseconds(1000); // delay(1);
-        c = analogRead(TOUCH_YP);
-        delayMicroseconds(1000); // delay(1);
-        b = analogRead(TOUCH_XN);
-        delayMicroseconds(1000); // delay(1);
-        d = analogRead(TOUCH_YP);
-
-        flag |= (absDiff(a, b) > 8);
-        flag |= (absDiff(c, d) > 8);
-        // z0 = (ANALOG_RESOLUTION - (c-a));
-        // Because a = TOUCH_XN non analog, remove a
-        z0 = ANALOG_RESOLUTION - c;
+        count = _touchCount;
+        x0 = _touchX;
+        y0 = _touchY;
+        z0 = _touchZ;
+    } while (count != _touchCount);
+
+    if (count == _touchRead) return false;
+    _touchRead = count;
+    return true;
+}
+
+// With an interrupt driving the sampler, only its published samples are read
+bool Screen_K35_Parallel::pollRawTouch(uint16_t &x0, uint16_t &y0, uint16_t &z0)
+{
+    if (!_touchInterrupt) pollTouch();
+    return getTouchSample(x0, y0, z0);
+}
+
+// Blocking reading for getTouch() and calibrateTouch(): one full cycle,
+// at most (retries + 1) * 11 settle times
+// When an interrupt drives the sampler, the cycle is left to it: the next
+// sample it publishes is waited for.
+void Screen_K35_Parallel::_getRawTouch(uint16_t &x0, uint16_t &y0, uint16_t &z0)
+{
+    if (_touchInterrupt) {
+        while (!getTouchSample(x0, y0, z0));
+        return;
+    }
+
+    _touchPhase = TOUCH_START;
+    _touchRetry = 0;
+    while (!pollTouch()) {
+        if (_touchSettle == 0) delayMicroseconds(1000);
     }
-    while (flag);
+    getTouchSample(x0, y0, z0);
 }
 
 void Screen_K35_Parallel::_setBacklight(bool flag)
@@ -55,9 +55,65 @@ public:
 
     ///
     /// @brief	Request information about the screen
-    /// @return	String with hardware version
+    /// @return	hardware version
     ///
-    String WhoAmI();
+    const char *WhoAmI();
+
+    ///
+    /// @brief	Hardware scroll
+    /// @details Row offset of the screen shows row 0, the content wraps around.
+    /// *   orientations 1 and 3: vertical scroll
+    /// *   orientations 0 and 2: horizontal scroll
+    /// @param	offset number of rows, or columns, the content moves up, or left
+    /// @param	vertical true for a vertical scroll
+    /// @return	false if the orientation does not allow that direction
+    ///
+    bool setScroll(uint16_t offset, bool vertical = true);
+
+    ///
+    /// @brief	Advance the touch sampler by one phase, without waiting
+    /// @details The sampler drives the panel for x, then y, then z, with two ADC
+    /// readings per axis, one phase per call. A phase waits for the settle
+    /// time set by setTouchTiming(), counted from the previous phase.
+    /// @return	true when a new sample has been published
+    /// @note   Call it from loop() or from a timer interrupt, not from both.
+    /// @n      From an interrupt, call setTouchInterrupt(true) first.
+    ///
+    bool pollTouch();
+
+    ///
+    /// @brief	Latest raw sample published by pollTouch()
+    /// @param	x0 raw x
+    /// @param	y0 raw y
+    /// @param	z0 raw pressure, 0 when no stable reading was found
+    /// @return	true if the sample is new since the previous call
+    ///
+    bool getTouchSample(uint16_t &x0, uint16_t &y0, uint16_t &z0);
+
+    ///
+    /// @brief	Timing of the touch sampler
+    /// @param	settle time in us between two phases, 0 for one phase per call,
+    /// @n      as from a timer interrupt with its own period
+    /// @param	retries number of new attempts when two readings differ,
+    /// @n      then a sample with z0 = 0 is published
+    ///
+    void setTouchTiming(uint16_t settle = 1000, uint8_t retries = 4);
+
+    ///
+    /// @brief	Whether a timer interrupt calls pollTouch()
+    /// @details getTouch() and calibrateTouch() then wait for the next sample
+    /// published by the interrupt, instead of driving the sampler themselves.
+    /// @param	flag true when pollTouch() is called from an interrupt
+    ///
+    void setTouchInterrupt(bool flag);
+
+    ///
+    /// @brief	One step of the touch sampler
+    /// @details With setTouchInterrupt(true), the sampler is not stepped and
+    /// only the samples published by the interrupt are returned.
+    /// @return	true when a new raw sample is returned
+    ///
+    bool pollRawTouch(uint16_t &x0, uint16_t &y0, uint16_t &z0);
 
     enum {F5529_INTERFACE_BOARD_NOT_INSTALLED = 0, F5529_INTERFACE_BOARD_INSTALLED = 1, TOUCH_ENABLED = 2, TOUCH_DISABLED = 3};
 
@@ -96,6 +152,19 @@ private:
 
     // Touch
     void _getOneTouch(uint8_t command8, uint8_t &a, uint8_t &b);
+    void _publishTouch(uint16_t z0);
+
+    // Touch sampler, the published sample may be written by an interrupt
+    uint8_t _touchPhase, _touchRetry, _touchRetries;
+    bool _touchUnstable;
+    uint16_t _touchSettle;
+    uint32_t _touchTime;
+    int16_t _touchA, _touchC;
+    uint16_t _touchRawX, _touchRawY;
+    volatile uint16_t _touchX, _touchY, _touchZ;
+    volatile uint8_t _touchCount;
+    uint8_t _touchRead;
+    bool _touchInterrupt;
 
     uint8_t _pinScreenDataCommand, _pinScreenReset, _pinScreenChipSelect, _pinScreenBackLight, _pinScreenWR, _pinScreenRD;
     uint8_t _pinScreenD0, _pinScreenD1, _pinScreenD2, _pinScreenD3, _pinScreenD4, _pinScreenD5, _pinScreenD6, _pinScreenD7;
@@ -0,0 +1,288 @@
+///
+/// @file       Terminal12c.h
+/// @brief      Compressed font library
+/// @details    Font Terminal 12 x 16, characters 0x20 to 0xFF
+/// @n          Glyphs trimmed to their bounding box and bit-packed, see LCD_font.h
+/// @n          Generated by extras/Tools/font_compress.py from Terminal12e.h, do not edit
+///
+/// @copyright  (c) Rei VILO, 2012-2016 - SPECIAL EDITION FOR ENERGIA
+/// @copyright  Attribution-NonCommercial-ShareAlike 3.0 Unported (CC BY-NC-SA 3.0)
+///
+/// @see        Font Generated by MikroElektronika GLCD Font Creator 1.2.0.0
+/// @n          MikroeElektronika 2011 http://www.mikroe.com
+///
+
+#ifndef TERMINAL12X16C_FONT_RELEASE
+#define TERMINAL12X16C_FONT_RELEASE 100
+
+#include "LCD_font.h"
+
+// With LCD_FONT_ASCII_ONLY, only characters 0x20 to 0x7E are linked
+
+static const uint16_t Terminal12x16c_bases[] =
+{
+        0,    89,   167,   337,   455,   617,   770,   926,  1048,  1167,  1279,  1392,
+#if !defined(LCD_FONT_ASCII_ONLY)
+     1489,  1576,  1664,  1705,  1788,  1885,  1965,  2036,  2124,  2286,  2418,  2567,
+     2712,  2852,  2976,  3114,  3249,
+#endif
+};
+
+static const uint8_t Terminal12x16c_offsets[] =
+{
+        0,     0,     9,    14,    33,    49,    67,    84,     0,    13,    26,    37,
+       47,    51,    55,    59,     0,    22,    38,    60,    82,   104,   126,   148,
+        0,    22,    44,    50,    57,    73,    82,    98,     0,    22,    42,    62,
+       82,   102,   122,   142,     0,    20,    33,    53,    73,    93,   113,   133,
+        0,    20,    40,    60,    80,    96,   116,   136,     0,    20,    40,    60,
+       73,    92,   105,   117,     0,     5,    19,    39,    53,    73,    87,   103,
+        0,    18,    29,    42,    58,    71,    85,    98,     0,    16,    32,    45,
+       56,    71,    85,    99,     0,    13,    26,    39,    56,    62,    79,    85,
+#if !defined(LCD_FONT_ASCII_ONLY)
+        0,    20,    20,    25,    42,    50,    57,    72,     0,     5,    23,    43,
+       48,    68,    68,    88,     0,     0,     5,    10,    18,    26,    32,    36,
+        0,     4,    13,    27,    32,    47,    47,    63,     0,     0,     9,    24,
+       40,    57,    77,    83,     0,     4,    22,    38,    46,    53,    57,    75,
+        0,     7,    16,    22,    28,    32,    48,    67,     0,     3,     7,    12,
+       20,    36,    52,    68,     0,    20,    40,    60,    80,   100,   120,   140,
+        0,    20,    40,    60,    80,    93,   106,   119,     0,    20,    40,    60,
+       80,   100,   120,   140,     0,    17,    37,    57,    77,    97,   117,   131,
+        0,    19,    38,    57,    74,    91,   110,   124,     0,    19,    38,    57,
+       76,    88,   100,   112,     0,    19,    35,    54,    73,    92,   109,   128,
+        0,    13,    32,    51,    70,    87,   103,   119,     0,
+#endif
+};
+
+static const uint8_t Terminal12x16c_data[] =
+{
+    0x43, 0x0D, 0x66, 0xFF, 0xFF, 0x6F, 0x66, 0x00, 0x66,  // 0x21
+    0x35, 0x23, 0xF3, 0x3C, 0xCF,  // 0x22
+    0x1A, 0x1B, 0x30, 0x83, 0x19, 0xCC, 0xFC, 0x8F, 0x19, 0xCC, 0x30, 0x83, 0x19, 0xFF, 0x31, 0x83, 0x19, 0xCC, 0x00,  // 0x23
+    0x27, 0x0D, 0x18, 0x18, 0x7E, 0xFF, 0x1B, 0x1B, 0x7F, 0xFE, 0xD8, 0xD8, 0xFF, 0x7E, 0x18, 0x18,  // 0x24
+    0x1A, 0x3A, 0x0E, 0x76, 0xB8, 0xE3, 0x80, 0x03, 0x0E, 0x38, 0xE0, 0x80, 0x03, 0x8E, 0x3B, 0xDC, 0xE0, 0x00,  // 0x25
+    0x28, 0x1C, 0x38, 0xD8, 0x98, 0x31, 0x63, 0x83, 0x83, 0x87, 0x0F, 0xB3, 0xE7, 0x8D, 0xB9, 0xE7, 0x19,  // 0x26
+    0x42, 0x05, 0xFF, 0xED, 0x01,  // 0x27
+    0x35, 0x0D, 0x38, 0xE3, 0x18, 0xC7, 0x71, 0x1C, 0xC7, 0x61, 0x38, 0x0C, 0x0E,  // 0x28
+    0x35, 0x0D, 0x07, 0xC3, 0x61, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0x71, 0xCC, 0x01,  // 0x29
+    0x27, 0x38, 0xDB, 0xDB, 0x7E, 0x3C, 0xFF, 0x3C, 0x7E, 0xDB, 0xDB,  // 0x2A
+    0x27, 0x47, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18,  // 0x2B
+    0x42, 0xB4, 0xFF, 0x3D,  // 0x2C
+    0x27, 0x71, 0xFF, 0xFF,  // 0x2D
+    0x42, 0xB2, 0xFF, 0x01,  // 0x2E
+    0x1A, 0x1B, 0x00, 0x04, 0x30, 0xC0, 0x01, 0x07, 0x1C, 0x70, 0xC0, 0x01, 0x07, 0x1C, 0x70, 0xC0, 0x01, 0x06, 0x00,  // 0x2F
+    0x1A, 0x0D, 0xF8, 0xF0, 0x9F, 0xC1, 0x06, 0x3E, 0xF8, 0x61, 0x8F, 0x79, 0xC6, 0x1B, 0x7E, 0xF0, 0x81, 0x0D, 0xE6, 0x3F, 0x7C, 0x00,  // 0x30
+    0x37, 0x0D, 0x18, 0x1C, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,  // 0x31
+    0x1A, 0x0D, 0xFC, 0xF1, 0xDF, 0xC1, 0x07, 0x3C, 0x70, 0xC0, 0x01, 0x07, 0x1C, 0x70, 0xC0, 0x01, 0x07, 0x1C, 0xF0, 0xFF, 0xFF, 0x03,  // 0x32
+    0x1A, 0x0D, 0xFC, 0xF1, 0xDF, 0xC1, 0x07, 0x0C, 0x60, 0x80, 0xE3, 0x0F, 0x3F, 0x00, 0x03, 0xF0, 0x80, 0x0F, 0xEE, 0x3F, 0xFE, 0x00,  // 0x33
+    0x1A, 0x0D, 0xC0, 0x01, 0x0F, 0x7C, 0x70, 0xC3, 0x19, 0xC7, 0x1C, 0x66, 0x30, 0xFF, 0xFF, 0x3F, 0x60, 0x00, 0x03, 0x18, 0xC0, 0x00,  // 0x34
+    0x1A, 0x0D, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x30, 0x80, 0xFF, 0xF8, 0x0F, 0xE0, 0x00, 0x06, 0xF0, 0x80, 0x0F, 0xEE, 0x3F, 0xFE, 0x00,  // 0x35
+    0x1A, 0x0D, 0xE0, 0x81, 0x0F, 0x0E, 0x38, 0xE0, 0x00, 0x03, 0xFC, 0xE7, 0x7F, 0x07, 0x1F, 0xF0, 0x80, 0x0F, 0xEE, 0x3F, 0xFE, 0x00,  // 0x36
+    0x1A, 0x0D, 0xFF, 0xFF, 0x3F, 0xC0, 0x00, 0x06, 0x18, 0xC0, 0x00, 0x03, 0x18, 0x60, 0x00, 0x03, 0x0C, 0x60, 0x80, 0x01, 0x0C, 0x00,  // 0x37
+    0x1A, 0x0D, 0xF8, 0xE0, 0x8F, 0xE3, 0x0C, 0x66, 0x30, 0xC7, 0xF1, 0xC7, 0x7F, 0x07, 0x1F, 0xF0, 0x80, 0x0F, 0xEE, 0x3F, 0xFE, 0x00,  // 0x38
+    0x1A, 0x0D, 0xFC, 0xF1, 0xDF, 0xC1, 0x07, 0x3C, 0xE0, 0x83, 0xFB, 0x9F, 0xFF, 0x00, 0x03, 0x1C, 0x70, 0xC0, 0xC1, 0x07, 0x1E, 0x00,  // 0x39
+    0x42, 0x48, 0xFF, 0x01, 0xFC, 0x07,  // 0x3A
+    0x42, 0x4B, 0xFF, 0x01, 0xFC, 0xB7, 0x07,  // 0x3B
+    0x27, 0x0D, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC0,  // 0x3C
+    0x28, 0x55, 0xFF, 0xFF, 0x03, 0x00, 0xF0, 0xFF, 0x3F,  // 0x3D
+    0x27, 0x0D, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03,  // 0x3E
+    0x19, 0x0D, 0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x83, 0x03, 0x07, 0x0E, 0x1C, 0x30, 0xC0, 0x00, 0x03, 0x00, 0x30, 0xC0, 0x00,  // 0x3F
+    0x1A, 0x0D, 0xFC, 0xF1, 0x9F, 0xC1, 0xE6, 0xBD, 0xEF, 0x6D, 0x6F, 0x7B, 0xDB, 0xDB, 0xDE, 0xDF, 0x7C, 0x0E, 0xE0, 0x1F, 0xFC, 0x00,  // 0x40
+    0x19, 0x0D, 0x30, 0xC0, 0x80, 0x07, 0x1E, 0x78, 0x30, 0xC3, 0x0C, 0x33, 0x86, 0xF9, 0xE7, 0xDF, 0xC0, 0x03, 0x0F, 0x0C,  // 0x41
+    0x19, 0x0D, 0x7F, 0xFC, 0x33, 0xDC, 0x60, 0x83, 0x0D, 0xF7, 0xCF, 0x7F, 0x83, 0x0F, 0x3C, 0xF0, 0xE0, 0xFF, 0xFD, 0x03,  // 0x42
+    0x19, 0x0D, 0xF8, 0xF0, 0xE7, 0xB8, 0xC1, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x60, 0xB0, 0xE3, 0xFC, 0xE1, 0x03,  // 0x43
+    0x19, 0x0D, 0x7F, 0xFC, 0x33, 0xDC, 0x60, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xD8, 0x70, 0xFF, 0xFC, 0x01,  // 0x44
+    0x19, 0x0D, 0xFF, 0xFF, 0x3F, 0xC0, 0x00, 0x03, 0x0C, 0xF0, 0xCF, 0x3F, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0xFF, 0xFF, 0x0F,  // 0x45
+    0x19, 0x0D, 0xFF, 0xFF, 0x3F, 0xC0, 0x00, 0x03, 0x0C, 0xF0, 0xCF, 0x3F, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x00,  // 0x46
+    0x19, 0x0D, 0xF8, 0xF1, 0xEF, 0xB0, 0x01, 0x03, 0x0C, 0x30, 0xFE, 0xF8, 0x03, 0x0F, 0x6C, 0xB0, 0xC3, 0xFC, 0xE3, 0x0F,  // 0x47
+    0x19, 0x0D, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0xFC, 0xFF, 0xFF, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x0C,  // 0x48
+    0x35, 0x0D, 0xFF, 0xCF, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0xFF, 0x0F,  // 0x49
+    0x19, 0x0D, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x0F, 0x3C, 0xF0, 0x61, 0xFE, 0xF1, 0x03,  // 0x4A
+    0x19, 0x0D, 0x03, 0x0F, 0x3E, 0xDC, 0x38, 0x73, 0xEC, 0xF0, 0xC1, 0x07, 0x3B, 0xCC, 0x31, 0xCE, 0x70, 0x83, 0x0F, 0x0C,  // 0x4B
+    0x19, 0x0D, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0xFF, 0xFF, 0x0F,  // 0x4C
+    0x19, 0x0D, 0x03, 0x1F, 0x7E, 0xF8, 0xF3, 0xCF, 0xEF, 0xBD, 0xF7, 0xCC, 0x33, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x0C,  // 0x4D
+    0x19, 0x0D, 0x03, 0x1F, 0x7C, 0xF0, 0xC3, 0x1B, 0x6F, 0x3C, 0xF3, 0xCC, 0x63, 0x8F, 0x3D, 0xFC, 0xE0, 0x83, 0x0F, 0x0C,  // 0x4E
+    0x19, 0x0D, 0x78, 0xF0, 0xE3, 0x9C, 0x61, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x6C, 0x98, 0x73, 0xFC, 0xE0, 0x01,  // 0x4F
+    0x19, 0x0D, 0xFF, 0xFC, 0x37, 0xF8, 0xC0, 0x03, 0x0F, 0x3C, 0xF8, 0x7F, 0xFF, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x00,  // 0x50
+    0x19, 0x0D, 0x78, 0xF0, 0xE3, 0x9C, 0x61, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x8F, 0x6D, 0x9E, 0x73, 0xFC, 0xE3, 0x0D,  // 0x51
+    0x19, 0x0D, 0xFF, 0xFC, 0x37, 0xF8, 0xC0, 0x03, 0x0F, 0x3C, 0xF8, 0x7F, 0xFF, 0xCC, 0x31, 0xCE, 0x70, 0x83, 0x0F, 0x0C,  // 0x52
+    0x19, 0x0D, 0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x1C, 0xE0, 0x0F, 0x7F, 0x80, 0x03, 0x3C, 0xF0, 0xE1, 0xFE, 0xF1, 0x03,  // 0x53
+    0x27, 0x0D, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,  // 0x54
+    0x19, 0x0D, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xB0, 0x61, 0xFE, 0xF1, 0x03,  // 0x55
+    0x19, 0x0D, 0x03, 0x0F, 0x3C, 0xB0, 0x61, 0x86, 0x19, 0xC6, 0x0C, 0x33, 0xCC, 0xE0, 0x81, 0x07, 0x1E, 0x30, 0xC0, 0x00,  // 0x56
+    0x19, 0x0D, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xCC, 0x33, 0xEF, 0xFD, 0xFC, 0xE1, 0x87, 0x0F, 0x0C,  // 0x57
+    0x19, 0x0D, 0x03, 0x0F, 0x6C, 0x98, 0x61, 0xCC, 0xE0, 0x01, 0x03, 0x0C, 0x78, 0x30, 0x63, 0x98, 0x61, 0x03, 0x0F, 0x0C,  // 0x58
+    0x19, 0x0D, 0x03, 0x0F, 0x6C, 0x98, 0x61, 0xCC, 0x30, 0x83, 0x07, 0x1E, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00,  // 0x59
+    0x19, 0x0D, 0xFF, 0xFF, 0x0F, 0x18, 0x60, 0xC0, 0x80, 0x01, 0x03, 0x0C, 0x18, 0x30, 0x60, 0x80, 0x01, 0xFF, 0xFF, 0x0F,  // 0x5A
+    0x35, 0x0D, 0xFF, 0x3F, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xFF, 0x0F,  // 0x5B
+    0x1A, 0x1B, 0x01, 0x18, 0xC0, 0x01, 0x1C, 0xC0, 0x01, 0x1C, 0xC0, 0x01, 0x1C, 0xC0, 0x01, 0x1C, 0xC0, 0x01, 0x0C,  // 0x5C
+    0x35, 0x0D, 0xFF, 0x0F, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0xFF, 0x0F,  // 0x5D
+    0x1A, 0x06, 0x20, 0x80, 0x03, 0x3E, 0xB8, 0xE3, 0xB8, 0x83, 0x0F, 0x18,  // 0x5E
+    0x1A, 0xE1, 0xFF, 0xFF, 0x3F,  // 0x5F
+    0x52, 0x15, 0xFF, 0x37, 0x03,  // 0x60
+    0x19, 0x58, 0xFC, 0xF9, 0x0F, 0x30, 0xFF, 0xFE, 0x0F, 0x3C, 0xF0, 0xFF, 0xFE, 0x03,  // 0x61
+    0x19, 0x0D, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0xEC, 0xF3, 0xDF, 0xE1, 0x03, 0x0F, 0x3C, 0xF0, 0xE0, 0xFF, 0xFD, 0x03,  // 0x62
+    0x19, 0x58, 0xFC, 0xF8, 0x77, 0xF0, 0x00, 0x03, 0x0C, 0x70, 0xB0, 0x7F, 0xFC, 0x00,  // 0x63
+    0x19, 0x0D, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0xF3, 0xED, 0xFF, 0xF1, 0x03, 0x0F, 0x3C, 0xF0, 0xC1, 0xFE, 0xF3, 0x0F,  // 0x64
+    0x19, 0x58, 0xFC, 0xF8, 0x77, 0xF0, 0xFF, 0xFF, 0x0D, 0x70, 0x80, 0x7F, 0xFC, 0x00,  // 0x65
+    0x17, 0x0D, 0xF0, 0xF8, 0x1C, 0x0C, 0x0C, 0x0C, 0x7F, 0x7F, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,  // 0x66
+    0x19, 0x5A, 0xFC, 0xFB, 0x7F, 0xF0, 0xC0, 0x87, 0xFB, 0xCF, 0x37, 0xC0, 0x80, 0xFB, 0xE7, 0x0F,  // 0x67
+    0x18, 0x0D, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xCF, 0xBF, 0xE3, 0x83, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0x30,  // 0x68
+    0x35, 0x2B, 0x0C, 0x03, 0x38, 0x0E, 0xC3, 0x30, 0x0C, 0xF3, 0xFF,  // 0x69
+    0x35, 0x2D, 0x30, 0x0C, 0xE0, 0x38, 0x0C, 0xC3, 0x30, 0x0C, 0xCF, 0xBF, 0x07,  // 0x6A
+    0x27, 0x0D, 0x03, 0x03, 0x03, 0x03, 0x03, 0x63, 0x73, 0x3B, 0x1F, 0x1F, 0x3B, 0x73, 0xE3, 0xC3,  // 0x6B
+    0x35, 0x0D, 0x8E, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0xFF, 0x0F,  // 0x6C
+    0x19, 0x58, 0xCD, 0xFC, 0xF7, 0xFF, 0xCC, 0x33, 0xCF, 0x3C, 0xF3, 0xCC, 0x33, 0x03,  // 0x6D
+    0x28, 0x58, 0x7F, 0xFE, 0x0D, 0x1F, 0x3C, 0x78, 0xF0, 0xE0, 0xC1, 0x83, 0x01,  // 0x6E
+    0x19, 0x58, 0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x0F, 0x7C, 0xB8, 0x7F, 0xFC, 0x00,  // 0x6F
+    0x19, 0x5A, 0xFF, 0xFC, 0x37, 0xF8, 0xC0, 0x03, 0x1F, 0xFE, 0xDF, 0x3E, 0x03, 0x0C, 0x30, 0x00,  // 0x70
+    0x19, 0x5A, 0xFC, 0xFB, 0x7F, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x3F, 0xDF, 0x00, 0x03, 0x0C, 0x30,  // 0x71
+    0x28, 0x58, 0xFB, 0xFE, 0x1F, 0x1E, 0x30, 0x60, 0xC0, 0x80, 0x01, 0x03, 0x00,  // 0x72
+    0x17, 0x58, 0x7E, 0xFF, 0x03, 0x7F, 0xFE, 0xC0, 0xC0, 0xFF, 0x7E,  // 0x73
+    0x17, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x7F, 0x7F, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0xFC, 0xF8,  // 0x74
+    0x19, 0x58, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x7C, 0xB8, 0xFF, 0x7C, 0x03,  // 0x75
+    0x19, 0x58, 0x03, 0x0F, 0x6C, 0x98, 0x61, 0xCC, 0x30, 0x83, 0x07, 0x1E, 0x30, 0x00,  // 0x76
+    0x19, 0x58, 0x33, 0xCF, 0x3C, 0xF3, 0xCC, 0x33, 0xEF, 0xED, 0x9F, 0x73, 0x84, 0x00,  // 0x77
+    0x18, 0x58, 0x83, 0x8F, 0xBB, 0xE3, 0x83, 0x83, 0x8F, 0xBB, 0xE3, 0x83, 0x01,  // 0x78
+    0x27, 0x5A, 0xC3, 0xC3, 0x66, 0x66, 0x3C, 0x3C, 0x18, 0x18, 0x0C, 0x0C, 0x06,  // 0x79
+    0x18, 0x58, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x01,  // 0x7A
+    0x27, 0x0E, 0xF0, 0xF8, 0x1C, 0x0C, 0x0C, 0x0C, 0x0E, 0x07, 0x0E, 0x0C, 0x0C, 0x0C, 0x1C, 0xF8, 0xF0,  // 0x7B
+    0x51, 0x0D, 0xFF, 0xCF, 0xFF, 0x0F,  // 0x7C
+    0x27, 0x0E, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x70, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F,  // 0x7D
+    0x19, 0x22, 0x1C, 0xDB, 0x36, 0x0E,  // 0x7E
+#if !defined(LCD_FONT_ASCII_ONLY)
+    0x19, 0x47, 0x30, 0xE0, 0xC1, 0x8C, 0x61, 0x03, 0x0F, 0xFC, 0xFF, 0xFF,  // 0x7F
+    0x19, 0x0D, 0xF0, 0xE0, 0xC7, 0x19, 0x03, 0x06, 0xFC, 0x61, 0x80, 0x01, 0x3F, 0x18, 0xC0, 0x18, 0xE7, 0xF8, 0xC1, 0x03,  // 0x80
+    0x52, 0x95, 0xFF, 0xED, 0x01,  // 0x82
+    0x18, 0x1C, 0xE0, 0xE0, 0xC3, 0x80, 0xC1, 0xCF, 0x0F, 0x06, 0x0C, 0x1C, 0x18, 0x30, 0x78, 0x60, 0x00,  // 0x83
+    0x36, 0x95, 0xF7, 0xFB, 0xDD, 0x6C, 0x9E, 0x01,  // 0x84
+    0x1A, 0xB2, 0x77, 0xBF, 0xFB, 0xDD, 0x01,  // 0x85
+    0x27, 0x1C, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,  // 0x86
+    0x27, 0x1C, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18,  // 0x87
+    0x35, 0x22, 0x8C, 0x37, 0x03,  // 0x88
+    0x1A, 0x3A, 0x0E, 0x76, 0xB8, 0xE3, 0x80, 0x03, 0x0E, 0x38, 0xE0, 0x80, 0x03, 0xCE, 0x3E, 0xF6, 0xB0, 0x01,  // 0x89
+    0x19, 0x0D, 0xD8, 0xC0, 0xC1, 0x8F, 0x7F, 0x87, 0x0F, 0x7C, 0x80, 0x3F, 0xFC, 0x01, 0x3E, 0xF0, 0xE1, 0xFE, 0xF1, 0x03,  // 0x8A
+    0x33, 0x54, 0x6C, 0x63, 0x0C,  // 0x8B
+    0x19, 0x0D, 0xF8, 0xF3, 0xEF, 0x86, 0x19, 0x63, 0x8C, 0x31, 0xDE, 0x78, 0x63, 0x8C, 0x61, 0x86, 0x1B, 0xFC, 0xE3, 0x0F,  // 0x8C
+    0x19, 0x0D, 0xCC, 0xE0, 0x01, 0xC3, 0xFF, 0xFF, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x01, 0xFF, 0xFF, 0x0F,  // 0x8E
+    0x52, 0x15, 0xDE, 0xFE, 0x03,  // 0x91
+    0x52, 0x15, 0xFF, 0xED, 0x01,  // 0x92
+    0x36, 0x15, 0xE6, 0xD9, 0xEC, 0x7E, 0xBF, 0x03,  // 0x93
+    0x36, 0x15, 0xF7, 0xFB, 0xDD, 0x6C, 0x9E, 0x01,  // 0x94
+    0x44, 0x54, 0xEE, 0xFF, 0xEF, 0x00,  // 0x95
+    0x35, 0x61, 0xFF, 0x0F,  // 0x96
+    0x19, 0x61, 0xFF, 0xFF, 0x0F,  // 0x97
+    0x36, 0x61, 0xEE, 0x1D,  // 0x98
+    0x19, 0x14, 0x3F, 0x92, 0x4D, 0x2A, 0x89, 0x24, 0x02,  // 0x99
+    0x17, 0x2B, 0x28, 0x10, 0x00, 0x7E, 0xFF, 0x03, 0x7F, 0xFE, 0xC0, 0xC0, 0xFF, 0x7E,  // 0x9A
+    0x43, 0x54, 0x63, 0x6C, 0x03,  // 0x9B
+    0x1A, 0x58, 0xDC, 0xF1, 0xDF, 0x8D, 0xC7, 0x3F, 0xBE, 0x11, 0xDC, 0xC0, 0x7F, 0xDC, 0x01,  // 0x9C
+    0x18, 0x2B, 0x28, 0x20, 0x00, 0xF8, 0xFF, 0x0F, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0xFC, 0xFF, 0x0F,  // 0x9E
+    0x19, 0x0D, 0xCC, 0x30, 0x03, 0xC0, 0xC0, 0x86, 0x31, 0x83, 0x07, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00,  // 0x9F
+    0x43, 0x2D, 0x66, 0x00, 0x66, 0xF6, 0xFF, 0xFF, 0x66,  // 0xA1
+    0x27, 0x1C, 0x18, 0x18, 0x7C, 0xFE, 0xDF, 0x1B, 0x1B, 0x1B, 0xDF, 0xFE, 0x7C, 0x18, 0x18,  // 0xA2
+    0x28, 0x1B, 0x70, 0xF0, 0x71, 0x66, 0xC0, 0xC0, 0xDF, 0x1F, 0x06, 0x0C, 0xFC, 0xFC, 0x37, 0x06,  // 0xA3
+    0x19, 0x1B, 0x03, 0xEF, 0xED, 0xDF, 0xE1, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x87, 0xFB, 0xB7, 0xF7, 0xC0,  // 0xA4
+    0x19, 0x0D, 0x03, 0x0F, 0x6C, 0x98, 0x61, 0xCC, 0x30, 0x83, 0x07, 0x1E, 0x30, 0xF8, 0x07, 0x83, 0x7F, 0x30, 0xC0, 0x00,  // 0xA5
+    0x51, 0x0D, 0xFF, 0x0F, 0xFF, 0x0F,  // 0xA6
+    0x27, 0x1B, 0x7E, 0xC3, 0x03, 0x03, 0x7E, 0xC3, 0xC3, 0x7E, 0xC0, 0xC0, 0xC3, 0x7E,  // 0xA7
+    0x35, 0x21, 0xF3, 0x0C,  // 0xA8
+    0x1A, 0x2A, 0xFC, 0xF1, 0xDF, 0xC1, 0xE7, 0xBC, 0xED, 0x0D, 0x6F, 0x7B, 0xCE, 0x07, 0xF7, 0x1F, 0x7F, 0x00,  // 0xA9
+    0x19, 0x0A, 0xFC, 0xF9, 0x0F, 0xB0, 0xFF, 0xFF, 0x0F, 0xFC, 0xBF, 0xFF, 0x00, 0xF8, 0xE7, 0x1F,  // 0xAA
+    0x18, 0x54, 0x8C, 0x8D, 0x8D, 0x31, 0xC6, 0x18,  // 0xAB
+    0x27, 0x64, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0,  // 0xAC
+    0x35, 0x71, 0xFF, 0x0F,  // 0xAD
+    0x1A, 0x2A, 0xFC, 0xF1, 0xDF, 0xC1, 0xF7, 0xBC, 0xED, 0x3D, 0x6F, 0x7B, 0xDB, 0x07, 0xF7, 0x1F, 0x7F, 0x00,  // 0xAE
+    0x19, 0x21, 0xFF, 0xFF, 0x0F,  // 0xAF
+    0x35, 0x05, 0xDE, 0x3F, 0xCF, 0xBF, 0x07,  // 0xB0
+    0x35, 0x48, 0x0C, 0xF3, 0xFF, 0x0C, 0x03, 0xFC, 0x3F,  // 0xB1
+    0x24, 0x04, 0x0F, 0xBB, 0xF1, 0x01,  // 0xB2
+    0x24, 0x04, 0x0F, 0x3B, 0xFC, 0x00,  // 0xB3
+    0x43, 0x22, 0x6C, 0x03,  // 0xB4
+    0x18, 0x4B, 0x83, 0x07, 0x0F, 0x1E, 0x3C, 0xF8, 0xF8, 0xBF, 0x3D, 0x03, 0x06, 0x0C, 0x18, 0x00,  // 0xB5
+    0x19, 0x1C, 0xFC, 0xDB, 0x36, 0xDB, 0x6C, 0xB3, 0xD9, 0xC6, 0x1B, 0x6C, 0xB0, 0xC1, 0x06, 0x1B, 0x6C, 0xB0, 0x01,  // 0xB6
+    0x43, 0x73, 0xF6, 0x6F,  // 0xB7
+    0x43, 0xC1, 0xFC,  // 0xB8
+    0x22, 0x04, 0xBE, 0x6D,  // 0xB9
+    0x23, 0x04, 0x96, 0x99, 0x06,  // 0xBA
+    0x18, 0x54, 0x63, 0x8C, 0x31, 0x36, 0x36, 0x06,  // 0xBB
+    0x19, 0x2A, 0x06, 0x1C, 0x60, 0x98, 0x31, 0x6F, 0xC0, 0x80, 0x35, 0xDB, 0xE6, 0x03, 0x0C, 0x30,  // 0xBC
+    0x19, 0x2A, 0x06, 0x1C, 0x60, 0x98, 0x31, 0x6F, 0xC0, 0x80, 0x1D, 0xC3, 0x86, 0x01, 0x03, 0x3C,  // 0xBD
+    0x19, 0x2A, 0x07, 0x30, 0x60, 0x18, 0x33, 0x67, 0xC0, 0x80, 0x35, 0xDB, 0xE6, 0x03, 0x0C, 0x30,  // 0xBE
+    0x19, 0x0D, 0x30, 0xC0, 0x00, 0x00, 0x0C, 0x30, 0xC0, 0x80, 0x03, 0x07, 0x0E, 0x1C, 0x3C, 0xF0, 0xE1, 0xFE, 0xF1, 0x03,  // 0xBF
+    0x19, 0x0D, 0x18, 0xC0, 0x00, 0x06, 0x00, 0x30, 0xE0, 0x81, 0x07, 0x33, 0xCC, 0x18, 0xE6, 0xDF, 0xFF, 0x03, 0x0F, 0x0C,  // 0xC0
+    0x19, 0x0D, 0x60, 0xC0, 0x80, 0x01, 0x00, 0x30, 0xE0, 0x81, 0x07, 0x33, 0xCC, 0x18, 0xE6, 0xDF, 0xFF, 0x03, 0x0F, 0x0C,  // 0xC1
+    0x19, 0x0D, 0x30, 0xE0, 0xC1, 0x0C, 0x00, 0x30, 0xE0, 0x81, 0x07, 0x33, 0xCC, 0x18, 0xE6, 0xDF, 0xFF, 0x03, 0x0F, 0x0C,  // 0xC2
+    0x19, 0x0D, 0xB8, 0xB1, 0x03, 0x00, 0x0C, 0x30, 0xE0, 0x81, 0x07, 0x33, 0xCC, 0x18, 0xE6, 0xDF, 0xFF, 0x03, 0x0F, 0x0C,  // 0xC3
+    0x19, 0x0D, 0xCC, 0x30, 0x03, 0x00, 0x0C, 0x30, 0xE0, 0x81, 0x07, 0x33, 0xCC, 0x18, 0xE6, 0xDF, 0xFF, 0x03, 0x0F, 0x0C,  // 0xC4
+    0x19, 0x0D, 0x30, 0x20, 0x01, 0x03, 0x00, 0x30, 0xE0, 0x81, 0x07, 0x33, 0xCC, 0x18, 0xE6, 0xDF, 0xFF, 0x03, 0x0F, 0x0C,  // 0xC5
+    0x19, 0x0D, 0xF0, 0xC3, 0x8F, 0x07, 0x1E, 0x78, 0xB0, 0xC1, 0x1E, 0x7B, 0x66, 0xF8, 0xE1, 0xC7, 0x18, 0xE3, 0x8F, 0x0F,  // 0xC6
+    0x19, 0x0F, 0xF8, 0xF0, 0xE7, 0xB8, 0xC1, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x60, 0xB0, 0xE3, 0xFC, 0xE1, 0x03, 0x06, 0x1C,  // 0xC7
+    0x19, 0x0D, 0x0C, 0x60, 0x00, 0xC3, 0xFF, 0xFF, 0x0F, 0x30, 0xC0, 0x3F, 0xFF, 0x0C, 0x30, 0xC0, 0x00, 0xFF, 0xFF, 0x0F,  // 0xC8
+    0x19, 0x0D, 0xC0, 0x80, 0x01, 0xC3, 0xFF, 0xFF, 0x0F, 0x30, 0xC0, 0x3F, 0xFF, 0x0C, 0x30, 0xC0, 0x00, 0xFF, 0xFF, 0x0F,  // 0xC9
+    0x19, 0x0D, 0x30, 0xE0, 0xC1, 0xCC, 0xFF, 0xFF, 0x0F, 0x30, 0xC0, 0x3F, 0xFF, 0x0C, 0x30, 0xC0, 0x00, 0xFF, 0xFF, 0x0F,  // 0xCA
+    0x19, 0x0D, 0xCC, 0x30, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0x30, 0xC0, 0x3F, 0xFF, 0x0C, 0x30, 0xC0, 0x00, 0xFF, 0xFF, 0x0F,  // 0xCB
+    0x35, 0x0D, 0x83, 0xC1, 0xFC, 0x3F, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0xFF, 0x0F,  // 0xCC
+    0x35, 0x0D, 0x30, 0xC6, 0xFC, 0x3F, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0xFF, 0x0F,  // 0xCD
+    0x35, 0x0D, 0x8C, 0x37, 0xFF, 0x3F, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0xFF, 0x0F,  // 0xCE
+    0x35, 0x0D, 0xF3, 0x0C, 0xFC, 0x3F, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0xFF, 0x0F,  // 0xCF
+    0x19, 0x0D, 0x7E, 0xF8, 0x63, 0x9C, 0x61, 0x06, 0x1B, 0xFC, 0xF0, 0xC3, 0x06, 0x1B, 0x6C, 0x98, 0x71, 0xFE, 0xF8, 0x01,  // 0xD0
+    0x19, 0x0D, 0xB8, 0xB1, 0x03, 0xC0, 0xC0, 0x07, 0x3F, 0xFC, 0xF1, 0xCE, 0x73, 0x8F, 0x3F, 0xFC, 0xE0, 0x03, 0x0F, 0x0C,  // 0xD1
+    0x19, 0x0D, 0x0C, 0x60, 0x00, 0x03, 0x3F, 0xFE, 0x1D, 0x3E, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xE1, 0xFE, 0xF1, 0x03,  // 0xD2
+    0x19, 0x0D, 0xC0, 0x80, 0x01, 0x03, 0x3F, 0xFE, 0x1D, 0x3E, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xE1, 0xFE, 0xF1, 0x03,  // 0xD3
+    0x19, 0x0D, 0x30, 0xE0, 0xC1, 0x0C, 0x3F, 0xFE, 0x1D, 0x3E, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xE1, 0xFE, 0xF1, 0x03,  // 0xD4
+    0x19, 0x0D, 0xB8, 0xB1, 0x03, 0x00, 0x3F, 0xFE, 0x1D, 0x3E, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xE1, 0xFE, 0xF1, 0x03,  // 0xD5
+    0x19, 0x0D, 0xCC, 0x30, 0x03, 0x00, 0x3F, 0xFE, 0x1D, 0x3E, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xE1, 0xFE, 0xF1, 0x03,  // 0xD6
+    0x27, 0x66, 0xC3, 0x66, 0x3C, 0x18, 0x3C, 0x66, 0xC3,  // 0xD7
+    0x19, 0x2B, 0x7C, 0xFB, 0x77, 0xFC, 0xD8, 0x63, 0xCF, 0x3C, 0xF3, 0xC6, 0x1B, 0x3F, 0xEE, 0xDF, 0x3E,  // 0xD8
+    0x19, 0x0D, 0x0C, 0x60, 0x00, 0xC3, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xB0, 0x61, 0xFE, 0xF1, 0x03,  // 0xD9
+    0x19, 0x0D, 0xC0, 0x80, 0x01, 0xC3, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xB0, 0x61, 0xFE, 0xF1, 0x03,  // 0xDA
+    0x19, 0x0D, 0x30, 0xE0, 0xC1, 0xCC, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xB0, 0x61, 0xFE, 0xF1, 0x03,  // 0xDB
+    0x19, 0x0D, 0xCC, 0x30, 0x03, 0xC0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xB0, 0x61, 0xFE, 0xF1, 0x03,  // 0xDC
+    0x19, 0x0D, 0xC0, 0x80, 0x01, 0xC3, 0xC0, 0x86, 0x31, 0x83, 0x07, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00,  // 0xDD
+    0x27, 0x2B, 0x0F, 0x0F, 0x06, 0x7E, 0xFE, 0xC6, 0xC6, 0xFE, 0x7E, 0x06, 0x0F, 0x0F,  // 0xDE
+    0x27, 0x4B, 0x3C, 0x66, 0xC3, 0xC3, 0x7F, 0xE3, 0xC3, 0xC3, 0xE3, 0x7F, 0x03, 0x03,  // 0xDF
+    0x19, 0x1C, 0x18, 0xC0, 0x00, 0x06, 0x00, 0xFC, 0xF9, 0x0F, 0x30, 0xFF, 0xFE, 0x0F, 0x3C, 0xF0, 0xFF, 0xFE, 0x03,  // 0xE0
+    0x19, 0x1C, 0x60, 0xC0, 0x80, 0x01, 0x00, 0xFC, 0xF9, 0x0F, 0x30, 0xFF, 0xFE, 0x0F, 0x3C, 0xF0, 0xFF, 0xFE, 0x03,  // 0xE1
+    0x19, 0x1C, 0x30, 0xE0, 0xC1, 0x0C, 0x00, 0xFC, 0xF9, 0x0F, 0x30, 0xFF, 0xFE, 0x0F, 0x3C, 0xF0, 0xFF, 0xFE, 0x03,  // 0xE2
+    0x19, 0x2B, 0xB8, 0xB1, 0x03, 0x00, 0x7F, 0xFE, 0x03, 0xCC, 0xBF, 0xFF, 0x03, 0x0F, 0xFC, 0xBF, 0xFF,  // 0xE3
+    0x19, 0x2B, 0xCC, 0x30, 0x03, 0x00, 0x7F, 0xFE, 0x03, 0xCC, 0xBF, 0xFF, 0x03, 0x0F, 0xFC, 0xBF, 0xFF,  // 0xE4
+    0x19, 0x1C, 0x70, 0x40, 0x01, 0x07, 0x00, 0xFC, 0xF9, 0x0F, 0x30, 0xFF, 0xFE, 0x0F, 0x3C, 0xF0, 0xFF, 0xFE, 0x03,  // 0xE5
+    0x19, 0x58, 0xDC, 0xF9, 0x0F, 0x33, 0x7F, 0xFE, 0xCC, 0x30, 0xC3, 0xFF, 0xDE, 0x01,  // 0xE6
+    0x19, 0x5A, 0xFC, 0xF8, 0x77, 0xF0, 0x00, 0x03, 0x0C, 0x70, 0xB0, 0x7F, 0xFC, 0x80, 0x01, 0x07,  // 0xE7
+    0x19, 0x1C, 0x18, 0xC0, 0x00, 0x06, 0x00, 0xFC, 0xF8, 0x77, 0xF0, 0xFF, 0xFF, 0x0D, 0x70, 0x80, 0x7F, 0xFC, 0x00,  // 0xE8
+    0x19, 0x1C, 0x60, 0xC0, 0x80, 0x01, 0x00, 0xFC, 0xF8, 0x77, 0xF0, 0xFF, 0xFF, 0x0D, 0x70, 0x80, 0x7F, 0xFC, 0x00,  // 0xE9
+    0x19, 0x1C, 0x30, 0xE0, 0xC1, 0x0C, 0x00, 0xFC, 0xF8, 0x77, 0xF0, 0xFF, 0xFF, 0x0D, 0x70, 0x80, 0x7F, 0xFC, 0x00,  // 0xEA
+    0x19, 0x1C, 0xCC, 0x30, 0x03, 0x00, 0x00, 0xFC, 0xF8, 0x77, 0xF0, 0xFF, 0xFF, 0x0D, 0x70, 0x80, 0x7F, 0xFC, 0x00,  // 0xEB
+    0x35, 0x1C, 0x06, 0x83, 0x01, 0x8E, 0xC3, 0x30, 0x0C, 0xC3, 0xFC, 0x3F,  // 0xEC
+    0x35, 0x1C, 0x18, 0x63, 0x00, 0x8E, 0xC3, 0x30, 0x0C, 0xC3, 0xFC, 0x3F,  // 0xED
+    0x35, 0x1C, 0x8C, 0x37, 0x03, 0x8E, 0xC3, 0x30, 0x0C, 0xC3, 0xFC, 0x3F,  // 0xEE
+    0x35, 0x1C, 0xF3, 0x0C, 0x00, 0x8E, 0xC3, 0x30, 0x0C, 0xC3, 0xFC, 0x3F,  // 0xEF
+    0x19, 0x1C, 0xD8, 0xC0, 0x81, 0x0D, 0x60, 0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x0F, 0x7C, 0xB8, 0x7F, 0xFC, 0x00,  // 0xF0
+    0x28, 0x2B, 0xDC, 0xEC, 0x00, 0xF8, 0xF3, 0x6F, 0xF8, 0xE0, 0xC1, 0x83, 0x07, 0x0F, 0x1E, 0x0C,  // 0xF1
+    0x19, 0x1C, 0x18, 0xC0, 0x00, 0x06, 0x00, 0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x0F, 0x7C, 0xB8, 0x7F, 0xFC, 0x00,  // 0xF2
+    0x19, 0x1C, 0x60, 0xC0, 0x80, 0x01, 0x00, 0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x0F, 0x7C, 0xB8, 0x7F, 0xFC, 0x00,  // 0xF3
+    0x19, 0x1C, 0x30, 0xE0, 0xC1, 0x0C, 0x00, 0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x0F, 0x7C, 0xB8, 0x7F, 0xFC, 0x00,  // 0xF4
+    0x19, 0x2B, 0xB8, 0xB1, 0x03, 0x00, 0x3F, 0xFE, 0x1D, 0x3E, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F,  // 0xF5
+    0x19, 0x1C, 0xCC, 0x30, 0x03, 0x00, 0x00, 0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x0F, 0x7C, 0xB8, 0x7F, 0xFC, 0x00,  // 0xF6
+    0x27, 0x47, 0x18, 0x18, 0x00, 0xFF, 0xFF, 0x00, 0x18, 0x18,  // 0xF7
+    0x28, 0x58, 0x7C, 0xFD, 0x1D, 0x1F, 0x3D, 0x79, 0xF1, 0x71, 0x7F, 0x7D, 0x00,  // 0xF8
+    0x19, 0x1C, 0x18, 0xC0, 0x00, 0x06, 0x00, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x7C, 0xB8, 0xFF, 0x7C, 0x03,  // 0xF9
+    0x19, 0x1C, 0x60, 0xC0, 0x80, 0x01, 0x00, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x7C, 0xB8, 0xFF, 0x7C, 0x03,  // 0xFA
+    0x19, 0x1C, 0x30, 0xE0, 0xC1, 0x0C, 0x00, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x7C, 0xB8, 0xFF, 0x7C, 0x03,  // 0xFB
+    0x19, 0x2B, 0xCC, 0x30, 0x03, 0xC0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x3F, 0xDF,  // 0xFC
+    0x27, 0x2D, 0x60, 0x30, 0x18, 0xC3, 0xC3, 0x66, 0x66, 0x3C, 0x3C, 0x18, 0x18, 0x0C, 0x0C, 0x06,  // 0xFD
+    0x27, 0x0D, 0x0F, 0x0F, 0x06, 0x7E, 0xFE, 0xC6, 0xC6, 0xC6, 0xC6, 0xFE, 0x7E, 0x06, 0x0F, 0x0F,  // 0xFE
+    0x27, 0x2D, 0x66, 0x66, 0x00, 0xC3, 0xC3, 0x66, 0x66, 0x3C, 0x3C, 0x18, 0x18, 0x0C, 0x0C, 0x06,  // 0xFF
+#endif
+};
+
+static const LCD_font Terminal12x16c =
+{
+#if defined(LCD_FONT_ASCII_ONLY)
+    12, 16, 0x20, 0x7E, 3, Terminal12x16c_bases, Terminal12x16c_offsets, Terminal12x16c_data, NULL
+#else
+    12, 16, 0x20, 0xFF, 3, Terminal12x16c_bases, Terminal12x16c_offsets, Terminal12x16c_data, NULL
+#endif
+};
+
+#endif
@@ -0,0 +1,280 @@
+///
+/// @file       Terminal16c.h
+/// @brief      Compressed font library
+/// @details    Font Terminal 16 x 24, characters 0x20 to 0xFF
+/// @n          Glyphs trimmed to their bounding box and bit-packed, see LCD_font.h
+/// @n          Generated by extras/Tools/font_compress.py from Terminal8e.h with EPX scaling, do not edit
+///
+/// @copyright  (c) Rei VILO, 2012-2016 - SPECIAL EDITION FOR ENERGIA
+/// @copyright  Attribution-NonCommercial-ShareAlike 3.0 Unported (CC BY-NC-SA 3.0)
+///
+/// @see        Font Generated by MikroElektronika GLCD Font Creator 1.2.0.0
+/// @n          MikroeElektronika 2011 http://www.mikroe.com
+///
+
+#ifndef TERMINAL16X24C_FONT_RELEASE
+#define TERMINAL16X24C_FONT_RELEASE 100
+
+#include "LCD_font.h"
+
+// With LCD_FONT_ASCII_ONLY, only characters 0x20 to 0x7E are linked
+
+static const uint16_t Terminal16x24c_bases[] =
+{
+        0,   195,   338,   579,   772,  1021,  1262,  1513,  1706,  1904,  2136,  2350,
+#if !defined(LCD_FONT_ASCII_ONLY)
+     2550,  2672,  2744,  2806,  2838,  3031,  3190,  3355,  3593,  3862,  4086,  4348,
+     4603,  4862,  5126,  5378,  5663,
+#endif
+};
+
+static const uint8_t Terminal16x24c_offsets[] =
+{
+        0,     0,    21,    33,    68,   107,   154,   189,     0,    25,    50,    71,
+       89,    98,   104,   110,     0,    30,    56,    86,   116,   151,   181,   211,
+        0,    30,    60,    74,    91,   121,   133,   163,     0,    39,    69,    99,
+      129,   159,   189,   219,     0,    30,    51,    81,   111,   141,   176,   211,
+        0,    30,    66,    96,   126,   156,   186,   216,     0,    30,    60,    90,
+      117,   150,   177,   186,     0,     6,    30,    60,    84,   114,   138,   168,
+        0,    30,    63,    96,   126,   156,   184,   208,     0,    30,    60,    84,
+      108,   138,   162,   186,     0,    24,    54,    78,   109,   124,   155,   170,
+#if !defined(LCD_FONT_ASCII_ONLY)
+        0,    30,    30,    37,    37,    50,    56,    89,     0,     0,    33,    33,
+       39,    72,    72,    72,     0,     0,     7,    14,    27,    40,    51,    56,
+        0,     9,    26,    26,    32,    32,    32,    32,     0,     0,    21,    54,
+       89,   110,   140,   154,     0,     9,    48,    72,    95,   107,   113,   152,
+        0,    15,    39,    52,    65,    71,   114,   159,     0,     9,    20,    44,
+       67,   114,   161,   208,     0,    33,    66,    99,   132,   165,   198,   233,
+        0,    33,    66,    99,   132,   155,   178,   201,     0,    35,    73,   106,
+      139,   172,   205,   238,     0,    30,    63,    96,   129,   162,   195,   225,
+        0,    33,    66,    99,   132,   165,   198,   229,     0,    33,    66,    99,
+      132,   165,   198,   231,     0,    30,    63,    96,   129,   162,   195,   228,
+        0,    24,    57,    90,   123,   156,   201,   240,     0,
+#endif
+};
+
+static const uint8_t Terminal16x24c_data[] =
+{
+    0x47, 0x02, 0x12, 0x18, 0x7E, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x7E, 0x3C, 0x3C, 0x18, 0x00, 0x00, 0x18, 0x3C, 0x3C, 0x18,  // 0x21
+    0x2B, 0x02, 0x06, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0x22
+    0x2D, 0x02, 0x12, 0x18, 0x06, 0xCF, 0xC3, 0xF3, 0xF8, 0x7C, 0xFF, 0xFF, 0xFF, 0xEF, 0xF3, 0xF1, 0x3C, 0x3C, 0x0F, 0xCF, 0xC3, 0xF3, 0xF8, 0x7C, 0xFF, 0xFF, 0xFF, 0xEF, 0xF3, 0xF1, 0x3C, 0x3C, 0x0F, 0x86, 0x01,  // 0x23
+    0x2B, 0x00, 0x18, 0x60, 0x80, 0x1F, 0xF8, 0xE1, 0x7F, 0x9E, 0xFF, 0xE0, 0x0F, 0xE0, 0x01, 0x1E, 0x80, 0x07, 0x78, 0x00, 0x1E, 0xE0, 0x01, 0x78, 0x80, 0x07, 0xF0, 0x07, 0xFF, 0x79, 0xFE, 0x87, 0x1F, 0xF8, 0x01, 0x0F, 0xF0, 0x00, 0x06,  // 0x24
+    0x0F, 0x00, 0x16, 0x78, 0x00, 0xFE, 0x01, 0xCE, 0x01, 0xCF, 0x03, 0xCF, 0x33, 0xCE, 0x31, 0xFE, 0x38, 0x78, 0x1C, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x07, 0xE0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x38, 0x1E, 0x1C, 0x7F, 0x8C, 0x73, 0xCC, 0xF3, 0xC0, 0xF3, 0x80, 0x73, 0x80, 0x7F, 0x00, 0x1E,  // 0x25
+    0x2D, 0x02, 0x12, 0x78, 0x80, 0x7F, 0xE0, 0x1C, 0x3C, 0x0F, 0xCF, 0x83, 0x73, 0xC0, 0x1F, 0xF0, 0x01, 0x1E, 0xC0, 0x03, 0xF0, 0xFC, 0x3F, 0xFF, 0x8F, 0xDF, 0xC3, 0xF3, 0xF0, 0x78, 0x7A, 0xFE, 0x3C, 0x3E, 0x0E,  // 0x26
+    0x63, 0x02, 0x06, 0xF6, 0xFF, 0x6F,  // 0x27
+    0x47, 0x00, 0x16, 0xE0, 0xF8, 0x78, 0x3C, 0x3C, 0x1E, 0x1E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1E, 0x1E, 0x3C, 0x3C, 0x78, 0xF8, 0xE0,  // 0x28
+    0x47, 0x00, 0x16, 0x07, 0x1F, 0x1E, 0x3C, 0x3C, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0x3C, 0x3C, 0x1E, 0x1F, 0x07,  // 0x29
+    0x2D, 0x06, 0x0A, 0x1C, 0x0E, 0xCF, 0x03, 0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0x3F, 0xC0, 0x0F, 0x3C, 0x0F, 0x87, 0x03,  // 0x2A
+    0x2B, 0x06, 0x0A, 0x60, 0x00, 0x0F, 0xF0, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0x0F, 0xF0, 0x00, 0x06,  // 0x2B
+    0x65, 0x10, 0x08, 0xDE, 0xFF, 0xFB, 0x3C, 0xF7, 0x1D,  // 0x2C
+    0x2B, 0x0A, 0x02, 0xFF, 0xFF, 0xFF,  // 0x2D
+    0x65, 0x10, 0x04, 0xDE, 0xFF, 0x7B,  // 0x2E
+    0x2B, 0x00, 0x14, 0x00, 0x06, 0xF0, 0x00, 0x0F, 0x78, 0x80, 0x07, 0x3C, 0xC0, 0x03, 0x1E, 0xE0, 0x01, 0x0F, 0xF0, 0x80, 0x07, 0x78, 0xC0, 0x03, 0x3C, 0xE0, 0x01, 0x1E, 0xF0, 0x00, 0x0F, 0x60, 0x00,  // 0x2F
+    0x4B, 0x02, 0x12, 0xF8, 0xE1, 0x7F, 0x1E, 0xF7, 0xF0, 0x8F, 0xFF, 0xFC, 0xCF, 0xFF, 0xF8, 0x8F, 0xFF, 0xF1, 0x1F, 0xFF, 0xF3, 0x3F, 0xFF, 0xF1, 0x0F, 0xEF, 0x78, 0xFE, 0x87, 0x1F,  // 0x30
+    0x29, 0x02, 0x12, 0x80, 0x81, 0x0F, 0x3E, 0xFE, 0xFF, 0xFF, 0x0F, 0x3E, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x06,  // 0x31
+    0x2B, 0x02, 0x12, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0x6F, 0xF0, 0x00, 0x0F, 0x78, 0x80, 0x07, 0x1E, 0xE0, 0x81, 0x07, 0x78, 0xE0, 0x01, 0x0E, 0xF0, 0x00, 0xFF, 0xEF, 0xFF,  // 0x32
+    0x2B, 0x02, 0x12, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0x6F, 0xF0, 0x00, 0x0F, 0x78, 0xF0, 0x03, 0x3F, 0x80, 0x07, 0xF0, 0x06, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0x33
+    0x2D, 0x02, 0x12, 0x18, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3C, 0x06, 0xCF, 0xC3, 0xF3, 0xF0, 0x3C, 0x3C, 0x8F, 0xC7, 0xE3, 0xF0, 0x3C, 0x7E, 0xFF, 0xBF, 0xFF, 0x0F, 0xF8, 0x01, 0x3C, 0x00, 0x0F, 0x80, 0x01,  // 0x34
+    0x2B, 0x02, 0x12, 0xFE, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xE1, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0x78, 0x80, 0x07, 0x1E, 0xFF, 0xF1, 0x07,  // 0x35
+    0x2B, 0x02, 0x12, 0xE0, 0x03, 0x3F, 0xF0, 0x81, 0x07, 0x38, 0xE0, 0x03, 0xFE, 0xF1, 0x7F, 0x9F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0x36
+    0x2B, 0x02, 0x12, 0xFF, 0xF7, 0xFF, 0x00, 0x0F, 0x70, 0x80, 0x07, 0x3C, 0xC0, 0x03, 0x1E, 0xE0, 0x01, 0x0F, 0xF0, 0x80, 0x07, 0x78, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0x80, 0x01,  // 0x37
+    0x2B, 0x02, 0x12, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF1, 0x1F, 0xEF, 0x73, 0xFC, 0xC3, 0x3F, 0xCE, 0xF7, 0xF8, 0x8F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0x38
+    0x2B, 0x02, 0x12, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F, 0xC0, 0x07, 0x1C, 0xE0, 0x81, 0x0F, 0xFC, 0xC0, 0x07,  // 0x39
+    0x65, 0x06, 0x0E, 0xDE, 0xFF, 0x7B, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFD, 0xBF, 0x07,  // 0x3A
+    0x65, 0x06, 0x12, 0xDE, 0xFF, 0x7B, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFD, 0xBF, 0xCF, 0x73, 0xDF, 0x01,  // 0x3B
+    0x2B, 0x02, 0x12, 0x00, 0x0E, 0xF8, 0x80, 0x07, 0x1E, 0xE0, 0x81, 0x07, 0x78, 0xE0, 0x01, 0x0F, 0xF0, 0x00, 0x1E, 0x80, 0x07, 0x78, 0x00, 0x1E, 0xE0, 0x01, 0x78, 0x80, 0x0F, 0xE0,  // 0x3C
+    0x2B, 0x08, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,  // 0x3D
+    0x2B, 0x02, 0x12, 0x07, 0xF0, 0x01, 0x1E, 0x80, 0x07, 0x78, 0x00, 0x1E, 0xE0, 0x01, 0x78, 0x00, 0x0F, 0xF0, 0x80, 0x07, 0x1E, 0xE0, 0x81, 0x07, 0x78, 0xE0, 0x01, 0x1F, 0x70, 0x00,  // 0x3E
+    0x2B, 0x02, 0x12, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0x6F, 0x78, 0x80, 0x07, 0x1E, 0xE0, 0x01, 0x0F, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0F, 0xF0, 0x00, 0x06,  // 0x3F
+    0x0F, 0x02, 0x12, 0xF8, 0x1F, 0xFE, 0x7F, 0x1E, 0x78, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x0F, 0xFE, 0x8F, 0xFF, 0x8F, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0x8F, 0xF3, 0x8F, 0xFF, 0x0F, 0x7E, 0x0F, 0x00, 0x1E, 0x00, 0xFE, 0xFF, 0xF8, 0xFF,  // 0x40
+    0x2B, 0x02, 0x12, 0x60, 0x80, 0x1F, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0x41
+    0x2B, 0x02, 0x12, 0xFE, 0xF1, 0x7F, 0x9F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x79, 0xFF, 0xF3, 0x3F, 0x9F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x79, 0xFF, 0xE7, 0x1F,  // 0x42
+    0x2B, 0x02, 0x12, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0x60, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF6, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0x43
+    0x2B, 0x02, 0x12, 0x7E, 0xF0, 0x1F, 0xCF, 0xF1, 0x78, 0x8F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x78, 0x8F, 0xF7, 0x1C, 0xFF, 0xE1, 0x07,  // 0x44
+    0x2B, 0x02, 0x12, 0xFE, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF3, 0x3F, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xEF, 0xFF,  // 0x45
+    0x2B, 0x02, 0x12, 0xFE, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF3, 0x3F, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x60, 0x00,  // 0x46
+    0x2B, 0x02, 0x12, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0x60, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xCF, 0xF7, 0xFC, 0x8F, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0x47
+    0x2B, 0x02, 0x12, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0x48
+    0x47, 0x02, 0x12, 0xFF, 0xFF, 0x7E, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7E, 0xFF, 0xFF,  // 0x49
+    0x2B, 0x02, 0x12, 0x00, 0x06, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x06, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0x4A
+    0x2B, 0x02, 0x12, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0x78, 0x8F, 0xF7, 0x3C, 0xCF, 0xF3, 0x1C, 0xFF, 0xF0, 0x0F, 0xCF, 0xF1, 0x3C, 0xCF, 0xF3, 0x78, 0x8F, 0xF7, 0xF0, 0x0F, 0x6F, 0x60,  // 0x4B
+    0x2B, 0x02, 0x12, 0x06, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xEF, 0xFF,  // 0x4C
+    0x2D, 0x02, 0x12, 0x06, 0xD8, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x3F, 0xFF, 0xCF, 0xFF, 0xCC, 0x3F, 0xF3, 0xCF, 0xFC, 0x33, 0xFF, 0xCC, 0x3F, 0xF3, 0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xBC, 0x01, 0x06,  // 0x4D
+    0x2D, 0x02, 0x12, 0x06, 0xD8, 0x03, 0xFF, 0xC0, 0x7F, 0xF0, 0x1F, 0xFC, 0x1F, 0xFF, 0xC7, 0xFF, 0xF3, 0xCF, 0xFF, 0xE3, 0xFF, 0xF8, 0x3F, 0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xBC, 0x01, 0x06,  // 0x4E
+    0x2B, 0x02, 0x12, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0x4F
+    0x2B, 0x02, 0x12, 0xFE, 0xF1, 0x7F, 0x9F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x79, 0xFF, 0xF7, 0x1F, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x60, 0x00,  // 0x50
+    0x2B, 0x02, 0x16, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x3F, 0xE0, 0x03, 0x78, 0x80, 0x0F, 0xE0,  // 0x51
+    0x2B, 0x02, 0x12, 0xFE, 0xF1, 0x7F, 0x9F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x79, 0xFF, 0xF7, 0x3F, 0xCF, 0xF3, 0x78, 0x8F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0x52
+    0x2B, 0x02, 0x12, 0xF8, 0xE1, 0x7F, 0x9E, 0xFF, 0xE0, 0x0F, 0xE0, 0x01, 0x1E, 0x80, 0x07, 0x78, 0x00, 0x1E, 0xE0, 0x01, 0x78, 0x80, 0x07, 0xF0, 0x07, 0xFF, 0x79, 0xFE, 0x87, 0x1F,  // 0x53
+    0x2B, 0x02, 0x12, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x06,  // 0x54
+    0x2B, 0x02, 0x12, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0x55
+    0x2B, 0x02, 0x12, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F, 0xF8, 0x01, 0x06,  // 0x56
+    0x2D, 0x02, 0x12, 0x06, 0xD8, 0x03, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0xCC, 0x3F, 0xF3, 0xCF, 0xFC, 0x33, 0xFF, 0xCC, 0x3B, 0x73, 0x1E, 0x1E, 0xCF, 0xC3, 0xF3, 0xF0, 0x3C, 0x3C, 0x0F, 0x86, 0x01,  // 0x57
+    0x2B, 0x02, 0x12, 0x06, 0xF6, 0xF0, 0x0F, 0xEF, 0x71, 0x1E, 0x87, 0x33, 0x78, 0x01, 0x0F, 0xF0, 0x80, 0x1E, 0xCC, 0xE1, 0x78, 0x8E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0x58
+    0x2B, 0x02, 0x12, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F, 0xF8, 0x01, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x06,  // 0x59
+    0x2B, 0x02, 0x12, 0xFF, 0xF7, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x0F, 0x78, 0x80, 0x07, 0x1E, 0xE0, 0x81, 0x07, 0x78, 0xE0, 0x01, 0x1E, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xEF, 0xFF,  // 0x5A
+    0x47, 0x00, 0x18, 0xFE, 0xFF, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0xFF, 0xFE,  // 0x5B
+    0x2B, 0x02, 0x14, 0x06, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0x1E, 0xC0, 0x03, 0x3C, 0x80, 0x07, 0x78, 0x00, 0x0F, 0xF0, 0x00, 0x1E, 0xE0, 0x01, 0x3C, 0xC0, 0x03, 0x78, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0x60,  // 0x5C
+    0x47, 0x00, 0x18, 0x7F, 0xFF, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0x7F,  // 0x5D
+    0x2B, 0x00, 0x04, 0xF8, 0xE1, 0x7F, 0x9F, 0x7F, 0xE0,  // 0x5E
+    0x0F, 0x16, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x5F
+    0x65, 0x00, 0x04, 0xC7, 0xE7, 0xE3,  // 0x60
+    0x2B, 0x06, 0x0E, 0xFC, 0xC1, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0xF8, 0xF8, 0xEF, 0xFF, 0x9E, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0x61
+    0x2B, 0x02, 0x12, 0x06, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF1, 0x7F, 0x9F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x79, 0xFF, 0xE7, 0x1F,  // 0x62
+    0x2B, 0x06, 0x0E, 0xF8, 0xE1, 0x7F, 0x9E, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xEE, 0xF9, 0xFE, 0x87, 0x1F,  // 0x63
+    0x2B, 0x02, 0x12, 0x00, 0x06, 0xF0, 0x00, 0x0F, 0xF8, 0xF8, 0xEF, 0xFF, 0x9E, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0x64
+    0x2B, 0x06, 0x0E, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x7F, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x83, 0x3F,  // 0x65
+    0x2B, 0x02, 0x12, 0xE0, 0x8F, 0xFF, 0x78, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x7E, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0x80, 0x01,  // 0x66
+    0x2B, 0x06, 0x12, 0xF8, 0xE7, 0xFF, 0x9E, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x0F, 0x78, 0xFF, 0xF7, 0x1F,  // 0x67
+    0x2B, 0x02, 0x12, 0x06, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF1, 0x7F, 0x9F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0x68
+    0x2B, 0x00, 0x14, 0x60, 0x00, 0x0F, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,  // 0x69
+    0x29, 0x00, 0x18, 0x80, 0x01, 0x0F, 0x3C, 0x60, 0x00, 0x00, 0xC0, 0x1F, 0xFF, 0xE0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x83, 0xF7, 0xDF, 0x1F,  // 0x6A
+    0x2B, 0x02, 0x12, 0x06, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF6, 0xF0, 0x0F, 0xFF, 0x78, 0x8F, 0xF7, 0x1C, 0xFF, 0xF0, 0x0F, 0xCF, 0xF1, 0x78, 0x8F, 0xF7, 0xF0, 0x0F, 0x6F, 0x60,  // 0x6B
+    0x2B, 0x02, 0x12, 0x7F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,  // 0x6C
+    0x2D, 0x06, 0x0E, 0xFE, 0xC7, 0xFF, 0xF7, 0xCC, 0x3D, 0xF3, 0xCF, 0xFC, 0x33, 0xFF, 0xCC, 0x3F, 0xF3, 0xCF, 0xFC, 0x33, 0xFF, 0xCC, 0x3F, 0xF3, 0x0F, 0xBC, 0x01, 0x06,  // 0x6D
+    0x2B, 0x06, 0x0E, 0xFE, 0xF1, 0x7F, 0x9F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0x6E
+    0x2B, 0x06, 0x0E, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0x6F
+    0x2B, 0x06, 0x12, 0xFE, 0xF1, 0x7F, 0x9F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x79, 0xFF, 0xF7, 0x1F, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x60, 0x00,  // 0x70
+    0x2B, 0x06, 0x12, 0xF8, 0xE7, 0xFF, 0x9E, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x60,  // 0x71
+    0x2B, 0x06, 0x0E, 0x06, 0xF6, 0xF8, 0xCF, 0xFF, 0x7C, 0x7F, 0xF0, 0x03, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x60, 0x00,  // 0x72
+    0x2B, 0x06, 0x0E, 0xF8, 0xEF, 0xFF, 0x1E, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x81, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0x78, 0xFF, 0xF7, 0x1F,  // 0x73
+    0x2B, 0x02, 0x12, 0x18, 0xC0, 0x03, 0x3C, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x7E, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0x80, 0x07, 0xF8, 0x0F, 0xFE,  // 0x74
+    0x2B, 0x06, 0x0E, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0x75
+    0x2B, 0x06, 0x0E, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F, 0xF8, 0x01, 0x06,  // 0x76
+    0x2D, 0x06, 0x0E, 0x06, 0xD8, 0x03, 0xFF, 0xCC, 0x3F, 0xF3, 0xCF, 0xFC, 0x33, 0xFF, 0xCC, 0x3F, 0xF3, 0xCF, 0xBC, 0x33, 0xE7, 0xE1, 0xF1, 0x3C, 0x3C, 0x0F, 0x86, 0x01,  // 0x77
+    0x2B, 0x06, 0x0E, 0x06, 0xF6, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0x6F, 0x60,  // 0x78
+    0x2B, 0x06, 0x12, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x3F, 0xC0, 0x03, 0x1C, 0xE0, 0x81, 0x0F, 0xFF, 0xF0, 0x07,  // 0x79
+    0x2B, 0x06, 0x0E, 0xFF, 0xF7, 0xFF, 0x00, 0x0F, 0x70, 0x80, 0x07, 0x1E, 0xE0, 0x81, 0x07, 0x78, 0xE0, 0x01, 0x0E, 0xF0, 0x00, 0xFF, 0xEF, 0xFF,  // 0x7A
+    0x29, 0x00, 0x16, 0x80, 0x83, 0x0F, 0x1E, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x1E, 0x78, 0x78, 0xF0, 0xC0, 0x03, 0x1E, 0xE0, 0x81, 0x07, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x78, 0xE0, 0x03, 0x0E,  // 0x7B
+    0x63, 0x00, 0x18, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F,  // 0x7C
+    0x49, 0x00, 0x16, 0x07, 0x7C, 0xE0, 0x01, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1E, 0x78, 0x80, 0x07, 0x3C, 0xF0, 0xE0, 0xE1, 0x81, 0x07, 0x0F, 0x3C, 0xF0, 0xC0, 0x83, 0x07, 0x1F, 0x1C, 0x00,  // 0x7D
+    0x0F, 0x02, 0x06, 0x78, 0xC0, 0xFE, 0xE1, 0xCE, 0xE1, 0x87, 0x73, 0x87, 0x7F, 0x03, 0x1E,  // 0x7E
+#if !defined(LCD_FONT_ASCII_ONLY)
+    0x2B, 0x02, 0x12, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x7F,  // 0x7F
+    0x2B, 0x02, 0x12, 0xE0, 0x83, 0x7F, 0x78, 0xCE, 0xC3, 0x3C, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0x3C, 0xC0, 0x03, 0xFF, 0xF0, 0x0F, 0x7E, 0xC0, 0x03, 0x3C, 0x8C, 0xE7, 0xF8, 0x07, 0x3E,  // 0x80
+    0x63, 0x10, 0x08, 0xF6, 0xEF, 0xCC, 0x37,  // 0x82
+    0x49, 0x10, 0x08, 0x86, 0x3D, 0xFF, 0xBC, 0xE3, 0x0C, 0x33, 0x7C, 0xDC, 0x30,  // 0x84
+    0x49, 0x12, 0x02, 0x33, 0xCF, 0x0C,  // 0x85
+    0x2B, 0x02, 0x14, 0x60, 0x00, 0x0F, 0xF0, 0x80, 0x1F, 0xFE, 0xF7, 0xFF, 0xFF, 0xEF, 0x7F, 0xF8, 0x01, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x06,  // 0x86
+    0x2B, 0x02, 0x14, 0x60, 0x00, 0x0F, 0xF0, 0x80, 0x1F, 0xFE, 0xF7, 0xFF, 0xFF, 0xEF, 0x7F, 0xF8, 0x01, 0x0F, 0xF0, 0x80, 0x1F, 0xFE, 0xF7, 0xFF, 0xFF, 0xEF, 0x7F, 0xF8, 0x01, 0x0F, 0xF0, 0x00, 0x06,  // 0x87
+    0x2B, 0x02, 0x14, 0x1E, 0xFC, 0xC3, 0x33, 0x3C, 0xE3, 0x3F, 0xE7, 0x31, 0x00, 0x03, 0x38, 0xC0, 0x01, 0x0C, 0xC0, 0x00, 0x0E, 0x70, 0x00, 0x03, 0x30, 0x80, 0x03, 0x1C, 0xC0, 0x00, 0xCC, 0xCC, 0xCC,  // 0x89
+    0x43, 0x0C, 0x06, 0xEC, 0x33, 0xCE,  // 0x8B
+    0x2B, 0x02, 0x14, 0xFC, 0xEF, 0xFF, 0xE7, 0x31, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x1C, 0xC3, 0x33, 0x3C, 0xC3, 0x31, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x70, 0x1E, 0xFE, 0xCF, 0xFF,  // 0x8C
+    0x63, 0x00, 0x08, 0xEC, 0x33, 0xF7, 0x6F,  // 0x91
+    0x63, 0x00, 0x08, 0xF6, 0xEF, 0xCC, 0x37,  // 0x92
+    0x49, 0x00, 0x08, 0x0C, 0x3B, 0x3E, 0xCC, 0x30, 0xC7, 0x3D, 0xFF, 0xBC, 0x61,  // 0x93
+    0x49, 0x00, 0x08, 0x86, 0x3D, 0xFF, 0xBC, 0xE3, 0x0C, 0x33, 0x7C, 0xDC, 0x30,  // 0x94
+    0x47, 0x08, 0x08, 0x18, 0x7E, 0x7E, 0xFF, 0xFF, 0x7E, 0x7E, 0x18,  // 0x95
+    0x47, 0x0C, 0x02, 0xFF, 0xFF,  // 0x96
+    0x2B, 0x0C, 0x02, 0xFF, 0xFF, 0xFF,  // 0x97
+    0x2B, 0x02, 0x04, 0x3C, 0xEC, 0xE7, 0xE7, 0x37, 0x3C,  // 0x98
+    0x2D, 0x00, 0x08, 0x3F, 0xF3, 0xCF, 0xEC, 0xF1, 0x33, 0xFC, 0x0C, 0x33, 0xC3, 0xCC, 0x30, 0x33, 0xCC,  // 0x99
+    0x63, 0x0C, 0x06, 0x73, 0xCC, 0x37,  // 0x9B
+    0x47, 0x06, 0x12, 0x18, 0x3C, 0x3C, 0x18, 0x00, 0x00, 0x18, 0x3C, 0x3C, 0x7E, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x7E, 0x18,  // 0xA1
+    0x2B, 0x02, 0x14, 0x60, 0x00, 0x0F, 0xF0, 0x80, 0x1F, 0xF8, 0xE1, 0x7F, 0x9E, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xEE, 0xF9, 0xFE, 0x87, 0x1F, 0xF8, 0x01, 0x0F, 0xF0, 0x00, 0x06,  // 0xA2
+    0x0D, 0x02, 0x12, 0xE0, 0x07, 0xFE, 0x87, 0xE7, 0xF3, 0xE0, 0x3C, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x01, 0xFF, 0xCF, 0xFF, 0xE3, 0x07, 0xF0, 0x00, 0x3C, 0x80, 0x07, 0xE0, 0x00, 0x3C, 0x00, 0xFF, 0xBF, 0xFF, 0x0F,  // 0xA3
+    0x2B, 0x04, 0x0C, 0x07, 0xFE, 0xF9, 0xFC, 0xC3, 0x3F, 0x9E, 0xF7, 0xF0, 0x0F, 0xEF, 0x79, 0xFC, 0xC3, 0x3F, 0x9F, 0x7F, 0xE0,  // 0xA4
+    0x2B, 0x02, 0x12, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFC, 0xC3, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0x0F, 0xF0, 0x00, 0x06,  // 0xA5
+    0x63, 0x02, 0x16, 0xF6, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x6F,  // 0xA6
+    0x2B, 0x00, 0x18, 0xF8, 0xE1, 0x7F, 0x9E, 0xFF, 0xE0, 0x0F, 0xE0, 0x01, 0x7E, 0xC0, 0x1F, 0xFC, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x3F, 0xF8, 0x03, 0x7E, 0x80, 0x07, 0xF0, 0x07, 0xFF, 0x79, 0xFE, 0x87, 0x1F,  // 0xA7
+    0x2B, 0x00, 0x04, 0x06, 0xF6, 0xF0, 0x0F, 0x6F, 0x60,  // 0xA8
+    0x0F, 0x02, 0x12, 0xF8, 0x1F, 0xFE, 0x7F, 0x1E, 0x78, 0x07, 0xE0, 0xC7, 0xE3, 0xE3, 0xC7, 0x73, 0xCE, 0x33, 0xCC, 0x33, 0xC0, 0x33, 0xC0, 0x33, 0xCC, 0x73, 0xCE, 0xE3, 0xC7, 0xC7, 0xE3, 0x07, 0xE0, 0x1E, 0x78, 0xFE, 0x7F, 0xF8, 0x1F,  // 0xA9
+    0x2B, 0x02, 0x0E, 0xFC, 0xC1, 0x7F, 0x00, 0x07, 0xF0, 0xF8, 0xEF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFE, 0x8F, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,  // 0xAA
+    0x0F, 0x0A, 0x0A, 0xE0, 0xE0, 0xF8, 0xF8, 0x78, 0x78, 0x1E, 0x1E, 0x0F, 0x0F, 0x0F, 0x0F, 0x1E, 0x1E, 0x78, 0x78, 0xF8, 0xF8, 0xE0, 0xE0,  // 0xAB
+    0x2B, 0x0A, 0x06, 0xFF, 0xF7, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x0F, 0x60,  // 0xAC
+    0x2B, 0x0A, 0x02, 0xFF, 0xFF, 0xFF,  // 0xAD
+    0x0F, 0x02, 0x12, 0xF8, 0x1F, 0xFE, 0x7F, 0x0E, 0x78, 0x07, 0xE0, 0xE3, 0xE3, 0xF3, 0xC7, 0x73, 0xCE, 0x33, 0xCC, 0x33, 0xCC, 0x73, 0xCE, 0xF3, 0xC3, 0xF3, 0xC3, 0x73, 0xCE, 0x33, 0xCC, 0x07, 0xE0, 0x0E, 0x70, 0xFE, 0x7F, 0xF8, 0x1F,  // 0xAE
+    0x0F, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xAF
+    0x2B, 0x00, 0x08, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xB0
+    0x2B, 0x06, 0x0E, 0x60, 0x00, 0x0F, 0xF0, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0x0F, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,  // 0xB1
+    0x47, 0x02, 0x0A, 0x1F, 0x7F, 0xF0, 0xF0, 0x78, 0x1E, 0x0E, 0x0F, 0xFF, 0xFE,  // 0xB2
+    0x47, 0x02, 0x0A, 0x1F, 0x7F, 0xF0, 0xF0, 0x3C, 0x3C, 0xF0, 0xF0, 0x7F, 0x1F,  // 0xB3
+    0x45, 0x00, 0x04, 0xB8, 0xFF, 0x1D,  // 0xB4
+    0x0F, 0x04, 0x14, 0x18, 0x18, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x7A, 0xFC, 0xF3, 0xFC, 0xE3, 0x7C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x07, 0x00,  // 0xB5
+    0x2D, 0x00, 0x18, 0xE0, 0x3F, 0xFE, 0x8F, 0xFF, 0xF9, 0x3F, 0xFE, 0xCF, 0xFF, 0xF3, 0xFF, 0xFC, 0x3F, 0xFF, 0x8F, 0xFF, 0xE3, 0xFF, 0xE0, 0x3F, 0xF8, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x18,  // 0xB6
+    0x65, 0x08, 0x04, 0xDE, 0xFF, 0x7B,  // 0xB7
+    0x47, 0x12, 0x06, 0x1C, 0x7C, 0xF0, 0xF0, 0x7F, 0x1F,  // 0xB8
+    0x45, 0x02, 0x0A, 0x98, 0xFF, 0xFF, 0x3E, 0xCF, 0xF3, 0x3C, 0x06,  // 0xB9
+    0x2B, 0x02, 0x0E, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,  // 0xBA
+    0x0F, 0x0A, 0x0A, 0x07, 0x07, 0x1F, 0x1F, 0x1E, 0x1E, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0x1E, 0x1E, 0x1F, 0x1F, 0x07, 0x07,  // 0xBB
+    0x0F, 0x00, 0x16, 0x18, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3E, 0xE0, 0x3C, 0xF8, 0x3C, 0x78, 0x3C, 0x1E, 0x3C, 0x1E, 0x18, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x78, 0x78, 0xFC, 0x38, 0xFE, 0x1E, 0xFF, 0x8F, 0xF3, 0xC7, 0xF3, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xF8, 0x00, 0x60,  // 0xBC
+    0x0F, 0x00, 0x16, 0x18, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3E, 0xE0, 0x3C, 0xF8, 0x3C, 0x78, 0x3C, 0x1E, 0x3C, 0x1E, 0x18, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xE0, 0x1F, 0xF8, 0x7F, 0x78, 0xF0, 0x1E, 0xF0, 0x1F, 0x78, 0x07, 0x1E, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0xFF, 0x00, 0xFE,  // 0xBD
+    0x0F, 0x00, 0x16, 0x1F, 0x00, 0x7F, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x3C, 0xE0, 0x3C, 0xF8, 0xF0, 0x78, 0xF0, 0x1C, 0x3F, 0x1E, 0x1F, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x78, 0x78, 0xFC, 0x38, 0xFE, 0x1E, 0xFF, 0x8F, 0xF3, 0xC7, 0xF3, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xF8, 0x00, 0x60,  // 0xBE
+    0x2B, 0x06, 0x12, 0x60, 0x00, 0x0F, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0F, 0xF0, 0x80, 0x07, 0x78, 0xE0, 0x01, 0x1E, 0xF6, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xBF
+    0x2B, 0x00, 0x14, 0x1C, 0xC0, 0x07, 0x70, 0x00, 0x1F, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0xC0
+    0x2B, 0x00, 0x14, 0x80, 0x03, 0x3E, 0xE0, 0x80, 0x0F, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0xC1
+    0x2B, 0x00, 0x14, 0xFC, 0xC3, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0xC2
+    0x2B, 0x00, 0x14, 0x3C, 0xEC, 0xE7, 0x87, 0x37, 0x3C, 0xE0, 0x80, 0x0F, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0xC3
+    0x2B, 0x00, 0x14, 0x0C, 0xC3, 0x39, 0x60, 0x00, 0x0F, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0xC4
+    0x2B, 0x00, 0x14, 0xF0, 0x80, 0x1F, 0x0C, 0xC3, 0x30, 0x60, 0x00, 0x0F, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0xC5
+    0x2D, 0x02, 0x12, 0x80, 0x3F, 0xF8, 0x0F, 0x7E, 0xE0, 0x0F, 0xF8, 0x83, 0xFF, 0xE0, 0x3C, 0x3C, 0x1F, 0xCF, 0xFF, 0xF3, 0xFF, 0x7F, 0xFC, 0x0F, 0xCF, 0xC3, 0xF3, 0xF0, 0x3C, 0x3C, 0x1F, 0xCF, 0xBF, 0xE1, 0x0F,  // 0xC6
+    0x2B, 0x02, 0x16, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0x60, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF6, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F, 0xF8, 0x00, 0x0E, 0xC0, 0x03, 0x3C, 0xFC, 0xC1, 0x07,  // 0xC7
+    0x2B, 0x00, 0x14, 0x3C, 0xC0, 0x03, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF3, 0x3F, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xEF, 0xFF,  // 0xC8
+    0x2B, 0x00, 0x14, 0xC0, 0x03, 0x3C, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF3, 0x3F, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xEF, 0xFF,  // 0xC9
+    0x2B, 0x00, 0x14, 0xFC, 0xC3, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF3, 0x3F, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xEF, 0xFF,  // 0xCA
+    0x2B, 0x00, 0x14, 0x0C, 0xC3, 0x30, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF3, 0x3F, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xEF, 0xFF,  // 0xCB
+    0x47, 0x00, 0x14, 0x0F, 0x0F, 0x00, 0x00, 0x18, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7E, 0xFF, 0xFF,  // 0xCC
+    0x47, 0x00, 0x14, 0xF0, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x7E, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7E, 0xFF, 0xFF,  // 0xCD
+    0x47, 0x00, 0x14, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x7E, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7E, 0xFF, 0xFF,  // 0xCE
+    0x47, 0x00, 0x14, 0xC3, 0xC3, 0x00, 0x00, 0xFF, 0xFF, 0x7E, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7E, 0xFF, 0xFF,  // 0xCF
+    0x0D, 0x02, 0x12, 0xF8, 0x01, 0xFF, 0xC1, 0x73, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0xCF, 0xC3, 0xFB, 0xF1, 0xFF, 0xFC, 0x3F, 0xEF, 0xC7, 0xF3, 0xF0, 0x3C, 0x3C, 0x8F, 0xC7, 0xE3, 0xF1, 0x1C, 0xFC, 0x07, 0x7E, 0x00,  // 0xD0
+    0x2D, 0x00, 0x14, 0x3C, 0x8C, 0x9F, 0x73, 0x7E, 0x0C, 0x0F, 0x00, 0x00, 0x00, 0x60, 0x80, 0x7D, 0xF0, 0x1F, 0xFC, 0x1F, 0xFF, 0xC7, 0xFF, 0xF3, 0xCF, 0xFF, 0xE3, 0xFF, 0xF8, 0x3F, 0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0xC0, 0x1B, 0x60,  // 0xD1
+    0x2B, 0x00, 0x14, 0x3C, 0xC0, 0x03, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xD2
+    0x2B, 0x00, 0x14, 0xC0, 0x03, 0x3C, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xD3
+    0x2B, 0x00, 0x14, 0xFC, 0xC3, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xD4
+    0x2B, 0x00, 0x14, 0xFC, 0xC3, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xD5
+    0x2B, 0x00, 0x14, 0x0C, 0xC3, 0x30, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xD6
+    0x2B, 0x04, 0x0E, 0x03, 0x7C, 0xE0, 0x07, 0xEE, 0x79, 0xFE, 0x87, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0xE1, 0x7F, 0x9E, 0x77, 0xE0, 0x07, 0x3E, 0xC0,  // 0xD7
+    0x2B, 0x02, 0x12, 0xF8, 0xE7, 0xFF, 0x1E, 0xFF, 0xF0, 0x8F, 0xFF, 0xFC, 0xCF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0x3F, 0xFF, 0xF1, 0x0F, 0xFF, 0x78, 0xFF, 0xE7, 0x1F,  // 0xD8
+    0x2B, 0x00, 0x14, 0x3C, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xD9
+    0x2B, 0x00, 0x14, 0xC0, 0x03, 0x3C, 0x00, 0x00, 0x00, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xDA
+    0x2B, 0x00, 0x14, 0xFC, 0xC3, 0x3F, 0x00, 0x00, 0x00, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xDB
+    0x2B, 0x00, 0x14, 0x0C, 0xC3, 0x30, 0x00, 0x00, 0x00, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xDC
+    0x2B, 0x00, 0x14, 0xC0, 0x03, 0x3C, 0x00, 0x00, 0x00, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F, 0xF8, 0x01, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x06,  // 0xDD
+    0x2B, 0x02, 0x12, 0x06, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF1, 0x7F, 0x9F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x79, 0xFF, 0xF7, 0x1F, 0x1F, 0xF0, 0x00, 0x0F, 0x60, 0x00,  // 0xDE
+    0x2B, 0x02, 0x12, 0x78, 0xE0, 0x1F, 0xCE, 0xF1, 0x3C, 0xCF, 0xF3, 0x3C, 0xCF, 0xF3, 0x78, 0x8F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x78, 0xCF, 0x67, 0x1C,  // 0xDF
+    0x2B, 0x00, 0x14, 0x1C, 0xC0, 0x07, 0xF8, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xFC, 0xC1, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0xF8, 0xF8, 0xEF, 0xFF, 0x9E, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0xE0
+    0x2B, 0x00, 0x14, 0x80, 0x03, 0x3E, 0xF0, 0x01, 0x07, 0x00, 0x00, 0x00, 0xFC, 0xC1, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0xF8, 0xF8, 0xEF, 0xFF, 0x9E, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0xE1
+    0x2B, 0x00, 0x14, 0xF0, 0x80, 0x1F, 0x9C, 0xC3, 0x30, 0x00, 0x00, 0x00, 0xFC, 0xC1, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0xF8, 0xF8, 0xEF, 0xFF, 0x9E, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0xE2
+    0x2B, 0x00, 0x14, 0x3C, 0xEC, 0xE7, 0xE7, 0x37, 0x3C, 0x00, 0x00, 0x00, 0xFC, 0xC1, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0xF8, 0xF8, 0xEF, 0xFF, 0x9E, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0xE3
+    0x2B, 0x00, 0x14, 0x06, 0xF6, 0xF0, 0x0F, 0x6F, 0x60, 0x00, 0x00, 0x00, 0xFC, 0xC1, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0xF8, 0xF8, 0xEF, 0xFF, 0x9E, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0xE4
+    0x2B, 0x00, 0x14, 0xF0, 0x80, 0x1F, 0x0C, 0xC3, 0x30, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0xC1, 0x7F, 0x00, 0x07, 0xF0, 0xF8, 0xEF, 0xFF, 0x9E, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0xE5
+    0x0F, 0x06, 0x0E, 0x3C, 0x1E, 0x3C, 0x7F, 0xA0, 0x73, 0xC0, 0xF3, 0xC0, 0xF3, 0xE0, 0xF3, 0xF8, 0xFF, 0xFE, 0x7F, 0xCE, 0x07, 0xCF, 0x03, 0xCF, 0x03, 0xCE, 0x05, 0xFE, 0xFC, 0x78, 0xFC,  // 0xE6
+    0x2B, 0x06, 0x12, 0xF8, 0xE1, 0x7F, 0x9E, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xEE, 0xF9, 0xFE, 0x87, 0x1F, 0xC0, 0x01, 0x0C, 0xFC, 0xC0, 0x07,  // 0xE7
+    0x2B, 0x00, 0x14, 0x1C, 0xC0, 0x07, 0xF8, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x7F, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x83, 0x3F,  // 0xE8
+    0x2B, 0x00, 0x14, 0x80, 0x03, 0x3E, 0xF0, 0x01, 0x07, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x7F, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x83, 0x3F,  // 0xE9
+    0x2B, 0x00, 0x14, 0xF0, 0x80, 0x1F, 0x9C, 0xC3, 0x30, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x7F, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x83, 0x3F,  // 0xEA
+    0x2B, 0x00, 0x14, 0x06, 0xF6, 0xF0, 0x0F, 0x6F, 0x60, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x7F, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x83, 0x3F,  // 0xEB
+    0x2B, 0x00, 0x14, 0x1C, 0xC0, 0x07, 0xF8, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,  // 0xEC
+    0x2B, 0x00, 0x14, 0x80, 0x03, 0x3E, 0xF0, 0x01, 0x07, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,  // 0xED
+    0x2B, 0x00, 0x14, 0xF0, 0x80, 0x1F, 0x9C, 0xC3, 0x30, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,  // 0xEE
+    0x2B, 0x00, 0x14, 0x06, 0xF6, 0xF0, 0x0F, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,  // 0xEF
+    0x2B, 0x02, 0x12, 0x1C, 0xCF, 0xF3, 0x70, 0x00, 0x0E, 0xCF, 0xF1, 0x7C, 0xF0, 0x07, 0xFF, 0x96, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xF0
+    0x2B, 0x00, 0x14, 0x3C, 0xEC, 0xE7, 0xE7, 0x37, 0x3C, 0x00, 0x00, 0x00, 0xFE, 0xF1, 0x7F, 0x9F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x6F, 0x60,  // 0xF1
+    0x2B, 0x00, 0x14, 0x1C, 0xC0, 0x07, 0xF8, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xF2
+    0x2B, 0x00, 0x14, 0x80, 0x03, 0x3E, 0xF0, 0x01, 0x07, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xF3
+    0x2B, 0x00, 0x14, 0xF0, 0x80, 0x1F, 0x9C, 0xC3, 0x30, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xF4
+    0x2B, 0x00, 0x14, 0x3C, 0xEC, 0xE7, 0xE7, 0x37, 0x3C, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xF5
+    0x2B, 0x00, 0x14, 0x06, 0xF6, 0xF0, 0x0F, 0x6F, 0x60, 0x00, 0x00, 0x00, 0xF8, 0xE1, 0x7F, 0x9E, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0x79, 0xFE, 0x87, 0x1F,  // 0xF6
+    0x2B, 0x04, 0x0E, 0x60, 0x00, 0x0F, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0F, 0xF0, 0x00, 0x06,  // 0xF7
+    0x2B, 0x06, 0x0E, 0xF8, 0xE7, 0xFF, 0x1E, 0xFF, 0xF0, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xF1, 0x0F, 0xFF, 0x78, 0xFF, 0xE7, 0x1F,  // 0xF8
+    0x2B, 0x00, 0x14, 0x1C, 0xC0, 0x07, 0xF8, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0xF9
+    0x2B, 0x00, 0x14, 0x80, 0x03, 0x3E, 0xF0, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0xFA
+    0x2B, 0x00, 0x14, 0xF8, 0xE1, 0x7F, 0x9F, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0xFB
+    0x2B, 0x00, 0x14, 0x06, 0xF6, 0xF0, 0x0F, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x06, 0xF6, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xEF, 0xF9, 0xFE, 0x8F, 0x7F,  // 0xFC
+    0x0D, 0x00, 0x18, 0x00, 0x0E, 0xE0, 0x03, 0x7C, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x81, 0xF1, 0xF0, 0x3C, 0x3C, 0x0F, 0xCF, 0xC3, 0xF3, 0xF0, 0x3C, 0x3C, 0x0F, 0xCF, 0xC3, 0xE3, 0x79, 0xF8, 0x1F, 0xF8, 0x03, 0xF0, 0x00, 0x1C, 0x80, 0x07, 0x78, 0xF0, 0x1F, 0xFC, 0x01,  // 0xFD
+    0x2B, 0x00, 0x18, 0x06, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF1, 0x7F, 0x9F, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x79, 0xFF, 0xF7, 0x1F, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x60, 0x00,  // 0xFE
+    0x0D, 0x00, 0x18, 0x18, 0x18, 0x0F, 0xCF, 0xC3, 0x63, 0x60, 0x00, 0x00, 0x00, 0x80, 0x81, 0xF1, 0xF0, 0x3C, 0x3C, 0x0F, 0xCF, 0xC3, 0xF3, 0xF0, 0x3C, 0x3C, 0x0F, 0xCF, 0xC3, 0xE3, 0x79, 0xF8, 0x1F, 0xF8, 0x03, 0xF0, 0x00, 0x1C, 0x80, 0x07, 0x78, 0xF0, 0x1F, 0xFC, 0x01,  // 0xFF
+#endif
+};
+
+static const LCD_font Terminal16x24c =
+{
+#if defined(LCD_FONT_ASCII_ONLY)
+    16, 24, 0x20, 0x7E, 3, Terminal16x24c_bases, Terminal16x24c_offsets, Terminal16x24c_data, NULL
+#else
+    16, 24, 0x20, 0xFF, 3, Terminal16x24c_bases, Terminal16x24c_offsets, Terminal16x24c_data, NULL
+#endif
+};
+
+#endif
@@ -0,0 +1,261 @@
+///
+/// @file       Terminal6c.h
+/// @brief      Compressed font library
+/// @details    Font Terminal 6 x 8, characters 0x20 to 0xFF
+/// @n          Glyphs bit-packed in whole cells, see LCD_font.h
+/// @n          Generated by extras/Tools/font_compress.py from Terminal6e.h, do not edit
+///
+/// @copyright  (c) Rei VILO, 2012-2016 - SPECIAL EDITION FOR ENERGIA
+/// @copyright  Attribution-NonCommercial-ShareAlike 3.0 Unported (CC BY-NC-SA 3.0)
+///
+/// @see        Font Generated by MikroElektronika GLCD Font Creator 1.2.0.0
+/// @n          MikroeElektronika 2011 http://www.mikroe.com
+///
+
+#ifndef TERMINAL6X8C_FONT_RELEASE
+#define TERMINAL6X8C_FONT_RELEASE 100
+
+#include "LCD_font.h"
+
+// With LCD_FONT_ASCII_ONLY, only characters 0x20 to 0x7E are linked
+
+static const uint8_t Terminal6x8c_data[] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x20
+    0x08, 0xC7, 0x21, 0x08, 0x80, 0x00,  // 0x21
+    0xB6, 0x2D, 0x01, 0x00, 0x00, 0x00,  // 0x22
+    0x00, 0xE5, 0x53, 0x94, 0x4F, 0x01,  // 0x23
+    0x04, 0x27, 0x30, 0x90, 0x83, 0x00,  // 0x24
+    0xA6, 0x09, 0x21, 0x84, 0x2C, 0x03,  // 0x25
+    0x84, 0xA2, 0x10, 0xAA, 0xC4, 0x02,  // 0x26
+    0x0C, 0x43, 0x00, 0x00, 0x00, 0x00,  // 0x27
+    0x08, 0x41, 0x10, 0x04, 0x81, 0x00,  // 0x28
+    0x04, 0x82, 0x20, 0x08, 0x42, 0x00,  // 0x29
+    0x00, 0xC5, 0xF9, 0x1C, 0x05, 0x00,  // 0x2A
+    0x00, 0x82, 0xF8, 0x08, 0x02, 0x00,  // 0x2B
+    0x00, 0x00, 0x00, 0x00, 0xC3, 0x10,  // 0x2C
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,  // 0x2D
+    0x00, 0x00, 0x00, 0x00, 0xC3, 0x00,  // 0x2E
+    0x00, 0x08, 0x21, 0x84, 0x00, 0x00,  // 0x2F
+    0x9C, 0x28, 0xAB, 0xA6, 0xC8, 0x01,  // 0x30
+    0x08, 0x83, 0x20, 0x08, 0xC2, 0x01,  // 0x31
+    0x9C, 0x08, 0x62, 0x84, 0xE0, 0x03,  // 0x32
+    0x9C, 0x08, 0x72, 0xA0, 0xC8, 0x01,  // 0x33
+    0x10, 0x46, 0x49, 0x3E, 0x04, 0x01,  // 0x34
+    0xBE, 0x20, 0x78, 0xA0, 0xC8, 0x01,  // 0x35
+    0x18, 0x21, 0x78, 0xA2, 0xC8, 0x01,  // 0x36
+    0x3E, 0x08, 0x21, 0x04, 0x41, 0x00,  // 0x37
+    0x9C, 0x28, 0x72, 0xA2, 0xC8, 0x01,  // 0x38
+    0x9C, 0x28, 0xF2, 0x20, 0xC4, 0x00,  // 0x39
+    0x00, 0xC0, 0x30, 0x00, 0xC3, 0x00,  // 0x3A
+    0x00, 0xC0, 0x30, 0x00, 0xC3, 0x10,  // 0x3B
+    0x10, 0x42, 0x08, 0x04, 0x02, 0x01,  // 0x3C
+    0x00, 0xE0, 0x03, 0x80, 0x0F, 0x00,  // 0x3D
+    0x04, 0x02, 0x81, 0x10, 0x42, 0x00,  // 0x3E
+    0x9C, 0x08, 0x62, 0x08, 0x80, 0x00,  // 0x3F
+    0x9C, 0xA8, 0xAB, 0xBA, 0xC0, 0x01,  // 0x40
+    0x9C, 0x28, 0x8A, 0xBE, 0x28, 0x02,  // 0x41
+    0x9E, 0x28, 0x7A, 0xA2, 0xE8, 0x01,  // 0x42
+    0x9C, 0x28, 0x08, 0x82, 0xC8, 0x01,  // 0x43
+    0x9E, 0x28, 0x8A, 0xA2, 0xE8, 0x01,  // 0x44
+    0xBE, 0x20, 0x78, 0x82, 0xE0, 0x03,  // 0x45
+    0xBE, 0x20, 0x78, 0x82, 0x20, 0x00,  // 0x46
+    0x9C, 0x28, 0xE8, 0xA2, 0xC8, 0x03,  // 0x47
+    0xA2, 0x28, 0xFA, 0xA2, 0x28, 0x02,  // 0x48
+    0x1C, 0x82, 0x20, 0x08, 0xC2, 0x01,  // 0x49
+    0x20, 0x08, 0x82, 0xA2, 0xC8, 0x01,  // 0x4A
+    0xA2, 0xA4, 0x18, 0x8A, 0x24, 0x02,  // 0x4B
+    0x82, 0x20, 0x08, 0x82, 0xE0, 0x03,  // 0x4C
+    0xA2, 0xAD, 0x8A, 0xA2, 0x28, 0x02,  // 0x4D
+    0xA2, 0xA9, 0xCA, 0xA2, 0x28, 0x02,  // 0x4E
+    0x9C, 0x28, 0x8A, 0xA2, 0xC8, 0x01,  // 0x4F
+    0x9E, 0x28, 0x7A, 0x82, 0x20, 0x00,  // 0x50
+    0x9C, 0x28, 0x8A, 0xAA, 0xC4, 0x02,  // 0x51
+    0x9E, 0x28, 0x7A, 0x92, 0x28, 0x02,  // 0x52
+    0x9C, 0x28, 0x70, 0xA0, 0xC8, 0x01,  // 0x53
+    0x3E, 0x82, 0x20, 0x08, 0x82, 0x00,  // 0x54
+    0xA2, 0x28, 0x8A, 0xA2, 0xC8, 0x01,  // 0x55
+    0xA2, 0x28, 0x8A, 0x22, 0x85, 0x00,  // 0x56
+    0xA2, 0xA8, 0xAA, 0xAA, 0x4A, 0x01,  // 0x57
+    0xA2, 0x48, 0x21, 0x94, 0x28, 0x02,  // 0x58
+    0xA2, 0x28, 0x52, 0x08, 0x82, 0x00,  // 0x59
+    0x1E, 0x84, 0x10, 0x82, 0xE0, 0x01,  // 0x5A
+    0x1C, 0x41, 0x10, 0x04, 0xC1, 0x01,  // 0x5B
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x00,  // 0x5C
+    0x1C, 0x04, 0x41, 0x10, 0xC4, 0x01,  // 0x5D
+    0x08, 0x25, 0x02, 0x00, 0x00, 0x00,  // 0x5E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,  // 0x5F
+    0x0C, 0x83, 0x00, 0x00, 0x00, 0x00,  // 0x60
+    0x00, 0xC0, 0x81, 0xBC, 0xC8, 0x03,  // 0x61
+    0x82, 0xE0, 0x89, 0xA2, 0xE8, 0x01,  // 0x62
+    0x00, 0xC0, 0x89, 0x82, 0xC8, 0x01,  // 0x63
+    0x20, 0xC8, 0x8B, 0xA2, 0xC8, 0x03,  // 0x64
+    0x00, 0xC0, 0x89, 0x9E, 0xC0, 0x01,  // 0x65
+    0x18, 0x41, 0x78, 0x04, 0x41, 0x00,  // 0x66
+    0x00, 0xC0, 0x8B, 0x22, 0x0F, 0x72,  // 0x67
+    0x82, 0xE0, 0x48, 0x92, 0x24, 0x01,  // 0x68
+    0x08, 0x80, 0x20, 0x08, 0x82, 0x01,  // 0x69
+    0x10, 0x80, 0x41, 0x10, 0x24, 0x31,  // 0x6A
+    0x82, 0x20, 0x29, 0x86, 0x22, 0x01,  // 0x6B
+    0x08, 0x82, 0x20, 0x08, 0x82, 0x01,  // 0x6C
+    0x00, 0x60, 0xA9, 0xAA, 0x28, 0x02,  // 0x6D
+    0x00, 0xE0, 0x48, 0x92, 0x24, 0x01,  // 0x6E
+    0x00, 0xC0, 0x89, 0xA2, 0xC8, 0x01,  // 0x6F
+    0x00, 0xE0, 0x89, 0xA2, 0xE8, 0x09,  // 0x70
+    0x00, 0xC0, 0x8B, 0xA2, 0xC8, 0x83,  // 0x71
+    0x00, 0xA0, 0x91, 0x04, 0xE1, 0x00,  // 0x72
+    0x00, 0xC0, 0x09, 0x1C, 0xC8, 0x01,  // 0x73
+    0x00, 0xE1, 0x11, 0x04, 0x85, 0x00,  // 0x74
+    0x00, 0x20, 0x49, 0x92, 0x46, 0x01,  // 0x75
+    0x00, 0x20, 0x8A, 0x22, 0x85, 0x00,  // 0x76
+    0x00, 0x20, 0x8A, 0xAA, 0x4F, 0x01,  // 0x77
+    0x00, 0x20, 0x49, 0x8C, 0x24, 0x01,  // 0x78
+    0x00, 0x20, 0x49, 0x12, 0x87, 0x18,  // 0x79
+    0x00, 0xE0, 0x41, 0x8C, 0xE0, 0x01,  // 0x7A
+    0x18, 0x41, 0x18, 0x04, 0x81, 0x01,  // 0x7B
+    0x08, 0x82, 0x00, 0x08, 0x82, 0x00,  // 0x7C
+    0x0C, 0x04, 0xC1, 0x10, 0xC4, 0x00,  // 0x7D
+    0x94, 0x02, 0x00, 0x00, 0x00, 0x00,  // 0x7E
+#if !defined(LCD_FONT_ASCII_ONLY)
+    0x08, 0x67, 0x8B, 0xA2, 0x0F, 0x00,  // 0x7F
+    0x38, 0xE1, 0x10, 0x0E, 0x89, 0x01,  // 0x80
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x81
+    0x00, 0x00, 0x00, 0x00, 0xC3, 0x10,  // 0x82
+    0x10, 0xC2, 0x21, 0x04, 0x21, 0x00,  // 0x83
+    0x00, 0x00, 0x00, 0x80, 0x6D, 0x4B,  // 0x84
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0x02,  // 0x85
+    0x08, 0x87, 0x20, 0x08, 0x02, 0x00,  // 0x86
+    0x08, 0x87, 0x20, 0x1C, 0x02, 0x00,  // 0x87
+    0x08, 0x05, 0x00, 0x00, 0x00, 0x00,  // 0x88
+    0xA6, 0x09, 0x21, 0x84, 0xA0, 0x02,  // 0x89
+    0x14, 0xE2, 0x0B, 0x1C, 0xE8, 0x03,  // 0x8A
+    0x00, 0x80, 0x10, 0x08, 0x00, 0x00,  // 0x8B
+    0xBC, 0xA2, 0x68, 0x8A, 0xC2, 0x03,  // 0x8C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x8D
+    0x14, 0xE2, 0x41, 0x8C, 0xE0, 0x01,  // 0x8E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x8F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x90
+    0x08, 0xC3, 0x00, 0x00, 0x00, 0x00,  // 0x91
+    0x0C, 0x43, 0x00, 0x00, 0x00, 0x00,  // 0x92
+    0x92, 0x6D, 0x03, 0x00, 0x00, 0x00,  // 0x93
+    0xB6, 0x4D, 0x02, 0x00, 0x00, 0x00,  // 0x94
+    0x00, 0x00, 0x30, 0x0C, 0x00, 0x00,  // 0x95
+    0x00, 0x00, 0x38, 0x00, 0x00, 0x00,  // 0x96
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,  // 0x97
+    0x00, 0x00, 0x50, 0x0A, 0x00, 0x00,  // 0x98
+    0xBF, 0xAA, 0x02, 0x00, 0x00, 0x00,  // 0x99
+    0x14, 0xC2, 0x09, 0x1C, 0xC8, 0x01,  // 0x9A
+    0x00, 0x40, 0x20, 0x04, 0x00, 0x00,  // 0x9B
+    0x00, 0x40, 0xA9, 0x9A, 0x42, 0x03,  // 0x9C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x9D
+    0x14, 0xE2, 0x41, 0x8C, 0xE0, 0x01,  // 0x9E
+    0x14, 0x20, 0x52, 0x08, 0x82, 0x00,  // 0x9F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xA0
+    0x00, 0x02, 0x20, 0x08, 0xC7, 0x21,  // 0xA1
+    0x00, 0xC2, 0x09, 0x02, 0x87, 0x00,  // 0xA2
+    0x18, 0x49, 0x38, 0x04, 0xA9, 0x01,  // 0xA3
+    0x22, 0x27, 0x8A, 0x22, 0x27, 0x02,  // 0xA4
+    0x22, 0x85, 0xF8, 0x88, 0x8F, 0x00,  // 0xA5
+    0x08, 0x82, 0x00, 0x08, 0x82, 0x00,  // 0xA6
+    0x9C, 0xE8, 0x50, 0xB8, 0xC8, 0x01,  // 0xA7
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00,  // 0xA8
+    0x5E, 0xD8, 0x96, 0x6D, 0xE8, 0x01,  // 0xA9
+    0x1C, 0xC8, 0x8B, 0x3C, 0xC0, 0x03,  // 0xAA
+    0x00, 0x40, 0x4A, 0x24, 0x00, 0x00,  // 0xAB
+    0x00, 0xE0, 0x83, 0x20, 0x00, 0x00,  // 0xAC
+    0x08, 0x80, 0x20, 0x1C, 0x87, 0x00,  // 0xAD
+    0x5E, 0x5A, 0xB7, 0x75, 0xE8, 0x01,  // 0xAE
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xAF
+    0x8C, 0x24, 0x49, 0x0C, 0xE0, 0x01,  // 0xB0
+    0x00, 0xC2, 0x21, 0x00, 0x07, 0x00,  // 0xB1
+    0x06, 0x42, 0x38, 0x00, 0x00, 0x00,  // 0xB2
+    0x0E, 0xC1, 0x18, 0x00, 0x00, 0x00,  // 0xB3
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xB4
+    0x00, 0x20, 0x49, 0x92, 0x23, 0x08,  // 0xB5
+    0xBC, 0xAA, 0xB2, 0x28, 0x8A, 0x02,  // 0xB6
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00,  // 0xB7
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x31,  // 0xB8
+    0x84, 0x41, 0x10, 0x00, 0x00, 0x00,  // 0xB9
+    0x8C, 0x24, 0x31, 0x00, 0x00, 0x00,  // 0xBA
+    0x00, 0x20, 0x91, 0x12, 0x00, 0x00,  // 0xBB
+    0x82, 0xA4, 0xD0, 0x2A, 0x0E, 0x02,  // 0xBC
+    0x82, 0xA4, 0x70, 0x22, 0x84, 0x03,  // 0xBD
+    0xA3, 0xB5, 0xD0, 0x2A, 0x0E, 0x02,  // 0xBE
+    0x08, 0x80, 0x30, 0x82, 0xC8, 0x01,  // 0xBF
+    0x0C, 0x80, 0x50, 0xA2, 0x2F, 0x02,  // 0xC0
+    0x18, 0x80, 0x50, 0xA2, 0x2F, 0x02,  // 0xC1
+    0x1C, 0x80, 0x50, 0xA2, 0x2F, 0x02,  // 0xC2
+    0x28, 0x85, 0x50, 0xA2, 0x2F, 0x02,  // 0xC3
+    0x14, 0x80, 0x50, 0xA2, 0x2F, 0x02,  // 0xC4
+    0x08, 0x85, 0x70, 0xA2, 0x2F, 0x02,  // 0xC5
+    0xBC, 0xA2, 0x68, 0x8E, 0xA2, 0x03,  // 0xC6
+    0x9C, 0x28, 0x08, 0x22, 0x87, 0x31,  // 0xC7
+    0x0C, 0xE0, 0x0B, 0x9E, 0xE0, 0x03,  // 0xC8
+    0x18, 0xE0, 0x0B, 0x9E, 0xE0, 0x03,  // 0xC9
+    0x1C, 0xE0, 0x0B, 0x9E, 0xE0, 0x03,  // 0xCA
+    0x14, 0xE0, 0x0B, 0x9E, 0xE0, 0x03,  // 0xCB
+    0x0C, 0xC0, 0x21, 0x08, 0xC2, 0x01,  // 0xCC
+    0x18, 0xC0, 0x21, 0x08, 0xC2, 0x01,  // 0xCD
+    0x1C, 0xC0, 0x21, 0x08, 0xC2, 0x01,  // 0xCE
+    0x14, 0xC0, 0x21, 0x08, 0xC2, 0x01,  // 0xCF
+    0x1C, 0x49, 0xBA, 0x24, 0xC9, 0x01,  // 0xD0
+    0x94, 0x02, 0x48, 0x96, 0x26, 0x01,  // 0xD1
+    0x06, 0x23, 0x49, 0x92, 0xC4, 0x00,  // 0xD2
+    0x18, 0x23, 0x49, 0x92, 0xC4, 0x00,  // 0xD3
+    0x1C, 0x23, 0x49, 0x92, 0xC4, 0x00,  // 0xD4
+    0x94, 0x62, 0x49, 0x92, 0xC4, 0x00,  // 0xD5
+    0x18, 0x23, 0x49, 0x92, 0xC4, 0x00,  // 0xD6
+    0x00, 0x00, 0x50, 0x08, 0x05, 0x00,  // 0xD7
+    0xBC, 0xAC, 0xAA, 0xAA, 0xE9, 0x01,  // 0xD8
+    0x18, 0x20, 0x49, 0x92, 0xC4, 0x00,  // 0xD9
+    0x06, 0x20, 0x49, 0x92, 0xC4, 0x00,  // 0xDA
+    0x1C, 0x20, 0x49, 0x92, 0xC4, 0x00,  // 0xDB
+    0x14, 0x20, 0x49, 0x92, 0xC4, 0x00,  // 0xDC
+    0x18, 0x20, 0x52, 0x08, 0x82, 0x00,  // 0xDD
+    0x80, 0x21, 0x38, 0x92, 0x23, 0x18,  // 0xDE
+    0x80, 0x23, 0x39, 0x92, 0xE4, 0x08,  // 0xDF
+    0x0C, 0xC0, 0x81, 0xBC, 0xC8, 0x03,  // 0xE0
+    0x30, 0xC0, 0x81, 0xBC, 0xC8, 0x03,  // 0xE1
+    0x1C, 0xC0, 0x81, 0xBC, 0xC8, 0x03,  // 0xE2
+    0x28, 0xC5, 0x83, 0xBC, 0xC8, 0x03,  // 0xE3
+    0x14, 0xC0, 0x81, 0xBC, 0xC8, 0x03,  // 0xE4
+    0x1C, 0xC5, 0x83, 0xBC, 0xC8, 0x03,  // 0xE5
+    0x00, 0x20, 0x49, 0x92, 0x23, 0x08,  // 0xE6
+    0x00, 0xC0, 0x89, 0x82, 0xC8, 0x31,  // 0xE7
+    0x06, 0xC0, 0x48, 0x8E, 0xC0, 0x00,  // 0xE8
+    0x18, 0xC0, 0x48, 0x8E, 0xC0, 0x00,  // 0xE9
+    0x1C, 0xC0, 0x48, 0x8E, 0xC0, 0x00,  // 0xEA
+    0x14, 0xC0, 0x48, 0x8E, 0xC0, 0x00,  // 0xEB
+    0x0C, 0x80, 0x20, 0x08, 0x82, 0x01,  // 0xEC
+    0x18, 0x80, 0x20, 0x08, 0x82, 0x01,  // 0xED
+    0x1C, 0x80, 0x20, 0x08, 0x82, 0x01,  // 0xEE
+    0x14, 0x80, 0x20, 0x08, 0x82, 0x01,  // 0xEF
+    0x2E, 0xC5, 0x8B, 0xA2, 0xC8, 0x01,  // 0xF0
+    0x94, 0x02, 0x38, 0x92, 0x24, 0x01,  // 0xF1
+    0x06, 0xC0, 0x48, 0x92, 0xC4, 0x00,  // 0xF2
+    0x18, 0xC0, 0x48, 0x92, 0xC4, 0x00,  // 0xF3
+    0x1C, 0xC0, 0x48, 0x92, 0xC4, 0x00,  // 0xF4
+    0x94, 0xC2, 0x48, 0x92, 0xC4, 0x00,  // 0xF5
+    0x14, 0xC0, 0x48, 0x92, 0xC4, 0x00,  // 0xF6
+    0x00, 0x02, 0xF8, 0x00, 0x02, 0x00,  // 0xF7
+    0x00, 0xC0, 0x4A, 0x2A, 0xA9, 0x01,  // 0xF8
+    0x06, 0x20, 0x49, 0x92, 0x46, 0x01,  // 0xF9
+    0x18, 0x20, 0x49, 0x92, 0x46, 0x01,  // 0xFA
+    0x1C, 0x20, 0x49, 0x92, 0x46, 0x01,  // 0xFB
+    0x14, 0x20, 0x49, 0x92, 0x46, 0x01,  // 0xFC
+    0x18, 0x20, 0x49, 0x12, 0x87, 0x18,  // 0xFD
+    0x86, 0xE0, 0x48, 0x92, 0x23, 0x18,  // 0xFE
+    0x14, 0x20, 0x49, 0x12, 0x87, 0x18,  // 0xFF
+#endif
+};
+
+static const LCD_font Terminal6x8c =
+{
+#if defined(LCD_FONT_ASCII_ONLY)
+    6, 8, 0x20, 0x7E, 0, NULL, NULL, Terminal6x8c_data, NULL
+#else
+    6, 8, 0x20, 0xFF, 0, NULL, NULL, Terminal6x8c_data, NULL
+#endif
+};
+
+#endif
@@ -0,0 +1,304 @@
+///
+/// @file       Terminal8p.h
+/// @brief      Compressed font library
+/// @details    Font Terminal 9 x 12, proportional, characters 0x20 to 0xFF
+/// @n          Glyphs trimmed to their bounding box and bit-packed, see LCD_font.h
+/// @n          Generated by extras/Tools/font_compress.py from Terminal8e.h, do not edit
+///
+/// @copyright  (c) Rei VILO, 2012-2016 - SPECIAL EDITION FOR ENERGIA
+/// @copyright  Attribution-NonCommercial-ShareAlike 3.0 Unported (CC BY-NC-SA 3.0)
+///
+/// @see        Font Generated by MikroElektronika GLCD Font Creator 1.2.0.0
+/// @n          MikroeElektronika 2011 http://www.mikroe.com
+///
+
+#ifndef TERMINAL8X12P_FONT_RELEASE
+#define TERMINAL8X12P_FONT_RELEASE 100
+
+#include "LCD_font.h"
+
+// With LCD_FONT_ASCII_ONLY, only characters 0x20 to 0x7E are linked
+
+static const uint16_t Terminal8x12p_bases[] =
+{
+        0,   108,   241,   387,   522,   657,
+#if !defined(LCD_FONT_ASCII_ONLY)
+      787,   850,   889,  1000,  1125,  1274,  1430,  1588,  1750,
+#endif
+};
+
+static const uint8_t Terminal8x12p_offsets[] =
+{
+        0,     0,     7,    12,    22,    33,    46,    56,    59,    67,    75,    82,
+       88,    92,    95,    98,     0,     9,    17,    26,    35,    45,    54,    63,
+       72,    81,    90,    95,   101,   110,   115,   124,     0,    11,    20,    29,
+       38,    47,    56,    65,    74,    83,    90,    99,   108,   117,   127,   137,
+        0,     9,    20,    29,    38,    47,    56,    65,    75,    84,    93,   102,
+      110,   120,   128,   132,     0,     3,    11,    20,    28,    37,    45,    54,
+       63,    72,    82,    92,   101,   110,   119,   127,     0,     9,    18,    26,
+       34,    43,    51,    59,    68,    76,    85,    93,   102,   107,   116,   121,
+#if !defined(LCD_FONT_ASCII_ONLY)
+        0,     9,     9,    12,    12,    17,    20,    30,    40,    40,    50,    50,
+       53,    63,    63,    63,     0,     0,     3,     6,    11,    16,    20,    23,
+       26,    30,    36,    36,    39,    39,    39,    39,     0,     0,     7,    17,
+       27,    34,    43,    48,    59,    63,    74,    82,    89,    94,    97,   108,
+        0,     5,    13,    18,    23,    26,    38,    51,    54,    58,    62,    70,
+       77,    90,   103,   116,     0,    10,    20,    30,    40,    50,    60,    70,
+       81,    91,   101,   111,   121,   128,   135,   142,     0,    10,    21,    31,
+       41,    51,    61,    71,    79,    88,    98,   108,   118,   128,   138,   147,
+        0,    10,    20,    30,    40,    50,    60,    69,    78,    88,    98,   108,
+      118,   128,   138,   148,     0,     9,    19,    29,    39,    49,    59,    69,
+       77,    85,    95,   105,   115,   125,   138,   149,     0,
+#endif
+};
+
+static const uint8_t Terminal8x12p_advances[] =
+{
+        4,     5,     7,     8,     7,     9,     8,     3,     5,     5,     8,     7,
+        4,     7,     4,     7,     7,     6,     7,     7,     8,     7,     7,     7,
+        7,     7,     4,     4,     7,     7,     7,     7,     9,     7,     7,     7,
+        7,     7,     7,     7,     7,     5,     7,     7,     7,     8,     8,     7,
+        7,     7,     7,     7,     7,     7,     7,     8,     7,     7,     7,     5,
+        7,     5,     7,     9,     4,     7,     7,     7,     7,     7,     7,     7,
+        7,     7,     6,     7,     7,     8,     7,     7,     7,     7,     7,     7,
+        7,     7,     7,     8,     7,     7,     7,     6,     3,     6,     9,
+#if !defined(LCD_FONT_ASCII_ONLY)
+        7,     7,     4,     3,     4,     6,     6,     7,     7,     4,     7,     4,
+        3,     7,     4,     4,     4,     4,     3,     3,     6,     6,     5,     5,
+        7,     7,     8,     4,     3,     4,     4,     4,     4,     4,     5,     7,
+        8,     7,     7,     3,     7,     7,     9,     7,     9,     7,     7,     9,
+        9,     7,     7,     5,     5,     4,     9,     8,     4,     5,     4,     7,
+        9,     9,     9,     9,     7,     7,     7,     7,     7,     7,     7,     8,
+        7,     7,     7,     7,     7,     5,     5,     5,     5,     8,     8,     7,
+        7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,
+        7,     7,     7,     7,     7,     7,     7,     9,     7,     7,     7,     7,
+        7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,
+        7,     7,     7,     7,     7,     7,     8,     7,     8,
+#endif
+};
+
+static const uint8_t Terminal8x12p_data[] =
+{
+    0x03, 0x18, 0xF6, 0xFF, 0x66, 0x60, 0x06,  // 0x21
+    0x05, 0x12, 0xF3, 0x3C, 0x03,  // 0x22
+    0x06, 0x18, 0x36, 0xDB, 0xDF, 0x66, 0xB3, 0xFD, 0x6D, 0x36,  // 0x23
+    0x05, 0x0B, 0x8C, 0x37, 0x0F, 0x06, 0x83, 0xC1, 0xB3, 0xC7, 0x30,  // 0x24
+    0x07, 0x0A, 0x0E, 0x1B, 0x5B, 0x6E, 0x30, 0x18, 0x0C, 0x76, 0xDA, 0xD8, 0x70,  // 0x25
+    0x06, 0x18, 0x8E, 0xCD, 0xC6, 0x31, 0xD8, 0xCF, 0x66, 0x6E,  // 0x26
+    0x01, 0x12, 0x3F,  // 0x27
+    0x03, 0x0A, 0x6C, 0x36, 0x33, 0x33, 0x66, 0x0C,  // 0x28
+    0x03, 0x0A, 0x63, 0xC6, 0xCC, 0xCC, 0x66, 0x03,  // 0x29
+    0x06, 0x34, 0x36, 0xCE, 0x9F, 0x63, 0x03,  // 0x2A
+    0x05, 0x34, 0x0C, 0xF3, 0x33, 0x0C,  // 0x2B
+    0x02, 0x83, 0xBF, 0x07,  // 0x2C
+    0x05, 0x50, 0x3F,  // 0x2D
+    0x02, 0x81, 0x3F,  // 0x2E
+    0x05, 0x09, 0x30, 0x8C, 0x61, 0x0C, 0x63, 0x18, 0xC3, 0x00,  // 0x2F
+    0x05, 0x18, 0xDE, 0xBC, 0xEF, 0xF3, 0x7D, 0xCF, 0x1E,  // 0x30
+    0x04, 0x18, 0x98, 0x7F, 0x8C, 0x31, 0xC6, 0x18,  // 0x31
+    0x05, 0x18, 0xDE, 0x3C, 0xC3, 0x18, 0x63, 0x0C, 0x3F,  // 0x32
+    0x05, 0x18, 0xDE, 0x3C, 0xC3, 0x1C, 0x3C, 0xCF, 0x1E,  // 0x33
+    0x06, 0x18, 0x06, 0x83, 0xCD, 0x66, 0x9B, 0xFD, 0x61, 0x30,  // 0x34
+    0x05, 0x18, 0xFF, 0x30, 0x0C, 0x1F, 0x0C, 0x63, 0x0F,  // 0x35
+    0x05, 0x18, 0x1C, 0x63, 0x7C, 0xF3, 0x3C, 0xCF, 0x1E,  // 0x36
+    0x05, 0x18, 0x3F, 0x8C, 0x61, 0x0C, 0x63, 0x18, 0x06,  // 0x37
+    0x05, 0x18, 0xDE, 0x3C, 0xDF, 0xDE, 0x3E, 0xCF, 0x1E,  // 0x38
+    0x05, 0x18, 0xDE, 0x3C, 0xCF, 0xB3, 0x8F, 0x31, 0x0E,  // 0x39
+    0x02, 0x36, 0x3F, 0x80, 0x1F,  // 0x3A
+    0x02, 0x38, 0x3F, 0x80, 0xDF, 0x03,  // 0x3B
+    0x05, 0x18, 0x30, 0xC6, 0x18, 0x83, 0xC1, 0x60, 0x30,  // 0x3C
+    0x05, 0x42, 0x3F, 0xF0, 0x03,  // 0x3D
+    0x05, 0x18, 0x83, 0xC1, 0x60, 0x30, 0xC6, 0x18, 0x03,  // 0x3E
+    0x05, 0x18, 0xDE, 0x3C, 0x63, 0x0C, 0x03, 0x30, 0x0C,  // 0x3F
+    0x07, 0x18, 0x7E, 0xC3, 0xC3, 0xF3, 0xDB, 0xDB, 0xF3, 0x03, 0xFE,  // 0x40
+    0x05, 0x18, 0x8C, 0x37, 0xCF, 0xF3, 0x3F, 0xCF, 0x33,  // 0x41
+    0x05, 0x18, 0xDF, 0x3C, 0xCF, 0xDF, 0x3C, 0xCF, 0x1F,  // 0x42
+    0x05, 0x18, 0xDE, 0x3C, 0x0F, 0xC3, 0x30, 0xCF, 0x1E,  // 0x43
+    0x05, 0x18, 0xCF, 0x36, 0xCF, 0xF3, 0x3C, 0x6F, 0x0F,  // 0x44
+    0x05, 0x18, 0xFF, 0x30, 0x0C, 0xDF, 0x30, 0x0C, 0x3F,  // 0x45
+    0x05, 0x18, 0xFF, 0x30, 0x0C, 0xDF, 0x30, 0x0C, 0x03,  // 0x46
+    0x05, 0x18, 0xDE, 0x3C, 0x0F, 0xC3, 0x3E, 0xCF, 0x3E,  // 0x47
+    0x05, 0x18, 0xF3, 0x3C, 0xCF, 0xFF, 0x3C, 0xCF, 0x33,  // 0x48
+    0x03, 0x18, 0x6F, 0x66, 0x66, 0x66, 0x0F,  // 0x49
+    0x05, 0x18, 0x30, 0x0C, 0xC3, 0x30, 0x3C, 0xCF, 0x1E,  // 0x4A
+    0x05, 0x18, 0xF3, 0xBC, 0x6D, 0xCF, 0xB6, 0xCD, 0x33,  // 0x4B
+    0x05, 0x18, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0x3F,  // 0x4C
+    0x06, 0x18, 0xE3, 0xF1, 0x7D, 0xBD, 0x5E, 0x8F, 0xC7, 0x63,  // 0x4D
+    0x06, 0x18, 0xE3, 0xF1, 0xF9, 0xBD, 0x9F, 0x8F, 0xC7, 0x63,  // 0x4E
+    0x05, 0x18, 0xDE, 0x3C, 0xCF, 0xF3, 0x3C, 0xCF, 0x1E,  // 0x4F
+    0x05, 0x18, 0xDF, 0x3C, 0xCF, 0xDF, 0x30, 0x0C, 0x03,  // 0x50
+    0x05, 0x1A, 0xDE, 0x3C, 0xCF, 0xF3, 0x3C, 0xCF, 0x1E, 0x06, 0x03,  // 0x51
+    0x05, 0x18, 0xDF, 0x3C, 0xCF, 0xDF, 0x36, 0xCF, 0x33,  // 0x52
+    0x05, 0x18, 0xDE, 0x3C, 0x18, 0x0C, 0x06, 0xCF, 0x1E,  // 0x53
+    0x05, 0x18, 0x3F, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C,  // 0x54
+    0x05, 0x18, 0xF3, 0x3C, 0xCF, 0xF3, 0x3C, 0xCF, 0x1E,  // 0x55
+    0x05, 0x18, 0xF3, 0x3C, 0xCF, 0xF3, 0x3C, 0x7B, 0x0C,  // 0x56
+    0x06, 0x18, 0xE3, 0xF1, 0x78, 0xBD, 0x5E, 0xDB, 0x6C, 0x36,  // 0x57
+    0x05, 0x18, 0xF3, 0x6C, 0x31, 0x8C, 0x36, 0xCF, 0x33,  // 0x58
+    0x05, 0x18, 0xF3, 0x3C, 0xCF, 0x1E, 0xC3, 0x30, 0x0C,  // 0x59
+    0x05, 0x18, 0x3F, 0x0C, 0x63, 0x8C, 0x31, 0x0C, 0x3F,  // 0x5A
+    0x03, 0x0B, 0x3F, 0x33, 0x33, 0x33, 0x33, 0xF3,  // 0x5B
+    0x05, 0x19, 0xC3, 0x60, 0x18, 0x0C, 0x83, 0x61, 0x30, 0x0C,  // 0x5C
+    0x03, 0x0B, 0xCF, 0xCC, 0xCC, 0xCC, 0xCC, 0xFC,  // 0x5D
+    0x05, 0x01, 0xDE, 0x0C,  // 0x5E
+    0x07, 0xB0, 0xFF,  // 0x5F
+    0x02, 0x01, 0x33,  // 0x60
+    0x05, 0x36, 0x1E, 0x0C, 0xFB, 0xF3, 0xEC, 0x03,  // 0x61
+    0x05, 0x18, 0xC3, 0xF0, 0xCD, 0xF3, 0x3C, 0xCF, 0x1F,  // 0x62
+    0x05, 0x36, 0xDE, 0x3C, 0x0C, 0xC3, 0xEC, 0x01,  // 0x63
+    0x05, 0x18, 0x30, 0xEC, 0xCF, 0xF3, 0x3C, 0xCF, 0x3E,  // 0x64
+    0x05, 0x36, 0xDE, 0x3C, 0xFF, 0xC3, 0xE0, 0x01,  // 0x65
+    0x05, 0x18, 0xBC, 0x61, 0x18, 0xBF, 0x61, 0x18, 0x06,  // 0x66
+    0x05, 0x38, 0xFE, 0x3C, 0xCF, 0xB3, 0x0F, 0xC3, 0x1F,  // 0x67
+    0x05, 0x18, 0xC3, 0xF0, 0xCD, 0xF3, 0x3C, 0xCF, 0x33,  // 0x68
+    0x05, 0x09, 0x0C, 0x03, 0x3C, 0x0C, 0xC3, 0x30, 0xCC, 0x0F,  // 0x69
+    0x04, 0x0B, 0x18, 0x03, 0x8F, 0x31, 0xC6, 0x18, 0xE3, 0x07,  // 0x6A
+    0x05, 0x18, 0xC3, 0x30, 0xCF, 0xDB, 0xB3, 0xCD, 0x33,  // 0x6B
+    0x05, 0x18, 0x0F, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x3F,  // 0x6C
+    0x06, 0x36, 0xBF, 0xF5, 0x7A, 0xBD, 0x5E, 0x8F, 0x01,  // 0x6D
+    0x05, 0x36, 0xDF, 0x3C, 0xCF, 0xF3, 0x3C, 0x03,  // 0x6E
+    0x05, 0x36, 0xDE, 0x3C, 0xCF, 0xF3, 0xEC, 0x01,  // 0x6F
+    0x05, 0x38, 0xDF, 0x3C, 0xCF, 0xF3, 0x37, 0x0C, 0x03,  // 0x70
+    0x05, 0x38, 0xFE, 0x3C, 0xCF, 0xB3, 0x0F, 0xC3, 0x30,  // 0x71
+    0x05, 0x36, 0xF3, 0x7E, 0x0C, 0xC3, 0x30, 0x00,  // 0x72
+    0x05, 0x36, 0xFE, 0x30, 0x78, 0x30, 0xFC, 0x01,  // 0x73
+    0x05, 0x18, 0x86, 0xF1, 0x1B, 0x86, 0x61, 0x18, 0x3C,  // 0x74
+    0x05, 0x36, 0xF3, 0x3C, 0xCF, 0xF3, 0xEC, 0x03,  // 0x75
+    0x05, 0x36, 0xF3, 0x3C, 0xCF, 0xB3, 0xC7, 0x00,  // 0x76
+    0x06, 0x36, 0xE3, 0xF5, 0x7A, 0xBD, 0xB6, 0xD9, 0x00,  // 0x77
+    0x05, 0x36, 0xF3, 0xEC, 0x31, 0xDE, 0x3C, 0x03,  // 0x78
+    0x05, 0x38, 0xF3, 0x3C, 0xCF, 0xB3, 0x87, 0x31, 0x0F,  // 0x79
+    0x05, 0x36, 0x3F, 0x8C, 0x31, 0xC6, 0xF0, 0x03,  // 0x7A
+    0x04, 0x0A, 0x98, 0x31, 0x66, 0x86, 0x61, 0x8C, 0x61,  // 0x7B
+    0x01, 0x0B, 0xFF, 0xFF, 0xFF,  // 0x7C
+    0x04, 0x0A, 0xC3, 0x18, 0xC3, 0x30, 0x33, 0xC6, 0x0C,  // 0x7D
+    0x07, 0x12, 0x8E, 0xDB, 0x71,  // 0x7E
+#if !defined(LCD_FONT_ASCII_ONLY)
+    0x05, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,  // 0x7F
+    0x05, 0x18, 0x9C, 0x69, 0x3C, 0xC6, 0x63, 0x98, 0x1C,  // 0x80
+    0x01, 0x83, 0x6F,  // 0x82
+    0x04, 0x83, 0x7B, 0xCB, 0x04,  // 0x84
+    0x04, 0x90, 0x15,  // 0x85
+    0x05, 0x19, 0x0C, 0xF3, 0xFF, 0x0C, 0xC3, 0x30, 0x0C, 0x03,  // 0x86
+    0x05, 0x19, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0x03,  // 0x87
+    0x05, 0x19, 0x67, 0x79, 0x41, 0x08, 0x42, 0x10, 0x82, 0x0A,  // 0x89
+    0x01, 0x62, 0x26,  // 0x8B
+    0x05, 0x19, 0x7E, 0x92, 0x24, 0x59, 0x92, 0x24, 0x89, 0x0F,  // 0x8C
+    0x01, 0x03, 0xF6,  // 0x91
+    0x01, 0x03, 0x6F,  // 0x92
+    0x04, 0x03, 0x32, 0xED, 0x0D,  // 0x93
+    0x04, 0x03, 0x7B, 0xCB, 0x04,  // 0x94
+    0x03, 0x43, 0xF6, 0x6F,  // 0x95
+    0x03, 0x60, 0x0F,  // 0x96
+    0x05, 0x60, 0x3F,  // 0x97
+    0x05, 0x11, 0x66, 0x06,  // 0x98
+    0x06, 0x03, 0x57, 0xB9, 0x54, 0x0A,  // 0x99
+    0x01, 0x62, 0x19,  // 0x9B
+    0x03, 0x38, 0x66, 0x60, 0xF6, 0xFF, 0x06,  // 0xA1
+    0x05, 0x19, 0x0C, 0xE3, 0xCD, 0xC3, 0x30, 0x7B, 0x0C, 0x03,  // 0xA2
+    0x06, 0x18, 0x3C, 0xB3, 0xC1, 0xF0, 0x33, 0x18, 0x06, 0x7F,  // 0xA3
+    0x05, 0x25, 0xB3, 0x37, 0xCF, 0xDE, 0x0C,  // 0xA4
+    0x05, 0x18, 0xF3, 0x3C, 0x7B, 0x3F, 0xF3, 0x33, 0x0C,  // 0xA5
+    0x01, 0x1A, 0xFF, 0xC3, 0x3F,  // 0xA6
+    0x05, 0x0B, 0xDE, 0x3C, 0x38, 0xDE, 0x3C, 0x7B, 0x1C, 0x3C, 0x7B,  // 0xA7
+    0x05, 0x01, 0xF3, 0x0C,  // 0xA8
+    0x07, 0x18, 0x7E, 0xC3, 0x99, 0xA5, 0x85, 0xA5, 0x99, 0xC3, 0x7E,  // 0xA9
+    0x05, 0x16, 0x1E, 0xEC, 0xCF, 0x3E, 0xF0, 0x03,  // 0xAA
+    0x07, 0x54, 0xCC, 0x66, 0x33, 0x66, 0xCC,  // 0xAB
+    0x05, 0x52, 0x3F, 0x0C, 0x03,  // 0xAC
+    0x05, 0x50, 0x3F,  // 0xAD
+    0x07, 0x18, 0x7E, 0xC3, 0x9D, 0xA5, 0xA5, 0x9D, 0xA5, 0xC3, 0x7E,  // 0xAE
+    0x07, 0x00, 0xFF,  // 0xAF
+    0x05, 0x03, 0xDE, 0x3C, 0x7B,  // 0xB0
+    0x05, 0x36, 0x0C, 0xF3, 0x33, 0x0C, 0xF0, 0x03,  // 0xB1
+    0x03, 0x14, 0xC7, 0x36, 0x0F,  // 0xB2
+    0x03, 0x14, 0xC7, 0xC6, 0x07,  // 0xB3
+    0x02, 0x01, 0x1E,  // 0xB4
+    0x07, 0x29, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xDE, 0x06, 0x06, 0x03,  // 0xB5
+    0x06, 0x0B, 0x7C, 0xDF, 0xEF, 0xF7, 0xF3, 0xF1, 0x60, 0x30, 0x18, 0x0C, 0x06,  // 0xB6
+    0x02, 0x41, 0x3F,  // 0xB7
+    0x03, 0x92, 0xC6, 0x07,  // 0xB8
+    0x02, 0x14, 0xBE, 0x6D,  // 0xB9
+    0x05, 0x16, 0xDE, 0x3C, 0xCF, 0x1E, 0xF0, 0x03,  // 0xBA
+    0x07, 0x54, 0x33, 0x66, 0xCC, 0x66, 0x33,  // 0xBB
+    0x07, 0x0A, 0x06, 0x07, 0xC6, 0x66, 0x36, 0x18, 0xEC, 0xF6, 0xDB, 0xF8, 0xC0,  // 0xBC
+    0x07, 0x0A, 0x06, 0x07, 0xC6, 0x66, 0x36, 0x18, 0x7C, 0xC6, 0x63, 0x30, 0xF0,  // 0xBD
+    0x07, 0x0A, 0x07, 0x0C, 0xC6, 0x6C, 0x37, 0x18, 0xEC, 0xF6, 0xDB, 0xF8, 0xC0,  // 0xBE
+    0x05, 0x38, 0x0C, 0x03, 0x30, 0x8C, 0x31, 0xCF, 0x1E,  // 0xBF
+    0x05, 0x09, 0x06, 0xE3, 0xCD, 0xF3, 0xFC, 0xCF, 0xF3, 0x0C,  // 0xC0
+    0x05, 0x09, 0x18, 0xE3, 0xCD, 0xF3, 0xFC, 0xCF, 0xF3, 0x0C,  // 0xC1
+    0x05, 0x09, 0x1E, 0xE3, 0xCD, 0xF3, 0xFC, 0xCF, 0xF3, 0x0C,  // 0xC2
+    0x05, 0x09, 0x66, 0xC6, 0x78, 0xF3, 0xFC, 0xCF, 0xF3, 0x0C,  // 0xC3
+    0x05, 0x09, 0x12, 0xE3, 0xCD, 0xF3, 0xFC, 0xCF, 0xF3, 0x0C,  // 0xC4
+    0x05, 0x09, 0x8C, 0xC4, 0x78, 0xF3, 0xFC, 0xCF, 0xF3, 0x0C,  // 0xC5
+    0x06, 0x18, 0x78, 0x8E, 0x67, 0xB3, 0xFF, 0x6C, 0x36, 0x7B,  // 0xC6
+    0x05, 0x1A, 0xDE, 0x3C, 0x0F, 0xC3, 0x3C, 0x7B, 0x0C, 0xE6, 0x00,  // 0xC7
+    0x05, 0x09, 0x06, 0xF0, 0x0F, 0xC3, 0x37, 0x0C, 0xC3, 0x0F,  // 0xC8
+    0x05, 0x09, 0x18, 0xF0, 0x0F, 0xC3, 0x37, 0x0C, 0xC3, 0x0F,  // 0xC9
+    0x05, 0x09, 0x1E, 0xF0, 0x0F, 0xC3, 0x37, 0x0C, 0xC3, 0x0F,  // 0xCA
+    0x05, 0x09, 0x12, 0xF0, 0x0F, 0xC3, 0x37, 0x0C, 0xC3, 0x0F,  // 0xCB
+    0x03, 0x09, 0x03, 0x66, 0x66, 0x66, 0xF6,  // 0xCC
+    0x03, 0x09, 0x0C, 0x6F, 0x66, 0x66, 0xF6,  // 0xCD
+    0x03, 0x09, 0x0F, 0x6F, 0x66, 0x66, 0xF6,  // 0xCE
+    0x03, 0x09, 0x09, 0x6F, 0x66, 0x66, 0xF6,  // 0xCF
+    0x06, 0x18, 0x1E, 0x9B, 0xD9, 0xFC, 0x36, 0x9B, 0x6D, 0x1E,  // 0xD0
+    0x06, 0x09, 0xA6, 0x0C, 0x60, 0x7C, 0x7E, 0xEF, 0xE7, 0xE3, 0x31,  // 0xD1
+    0x05, 0x09, 0x06, 0xE0, 0xCD, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xD2
+    0x05, 0x09, 0x18, 0xE0, 0xCD, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xD3
+    0x05, 0x09, 0x1E, 0xE0, 0xCD, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xD4
+    0x05, 0x09, 0x1E, 0xE0, 0xCD, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xD5
+    0x05, 0x09, 0x12, 0xE0, 0xCD, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xD6
+    0x05, 0x26, 0xE1, 0xEC, 0x31, 0xDE, 0x1C, 0x02,  // 0xD7
+    0x05, 0x18, 0xFE, 0xBC, 0xEF, 0xFF, 0x7D, 0xCF, 0x1F,  // 0xD8
+    0x05, 0x09, 0x06, 0x30, 0xCF, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xD9
+    0x05, 0x09, 0x18, 0x30, 0xCF, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xDA
+    0x05, 0x09, 0x1E, 0x30, 0xCF, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xDB
+    0x05, 0x09, 0x12, 0x30, 0xCF, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xDC
+    0x05, 0x09, 0x18, 0x30, 0xCF, 0xB3, 0xC7, 0x30, 0x0C, 0x03,  // 0xDD
+    0x05, 0x18, 0xC3, 0xF0, 0xCD, 0xF3, 0xFC, 0x0D, 0x03,  // 0xDE
+    0x05, 0x18, 0xCE, 0xB6, 0x6D, 0xF3, 0x3C, 0xCF, 0x1B,  // 0xDF
+    0x05, 0x09, 0x06, 0x03, 0x78, 0x30, 0xEC, 0xCF, 0xB3, 0x0F,  // 0xE0
+    0x05, 0x09, 0x18, 0x03, 0x78, 0x30, 0xEC, 0xCF, 0xB3, 0x0F,  // 0xE1
+    0x05, 0x09, 0x8C, 0x04, 0x78, 0x30, 0xEC, 0xCF, 0xB3, 0x0F,  // 0xE2
+    0x05, 0x09, 0x66, 0x06, 0x78, 0x30, 0xEC, 0xCF, 0xB3, 0x0F,  // 0xE3
+    0x05, 0x09, 0xF3, 0x0C, 0x78, 0x30, 0xEC, 0xCF, 0xB3, 0x0F,  // 0xE4
+    0x05, 0x09, 0x8C, 0xC4, 0x00, 0x1E, 0xEC, 0xCF, 0xB3, 0x0F,  // 0xE5
+    0x07, 0x36, 0x76, 0xD8, 0xD8, 0xFE, 0x1B, 0x1B, 0xEE,  // 0xE6
+    0x05, 0x38, 0xDE, 0x3C, 0x0C, 0xC3, 0xEC, 0x21, 0x0E,  // 0xE7
+    0x05, 0x09, 0x06, 0x03, 0x78, 0xF3, 0xFC, 0x0F, 0x83, 0x07,  // 0xE8
+    0x05, 0x09, 0x18, 0x03, 0x78, 0xF3, 0xFC, 0x0F, 0x83, 0x07,  // 0xE9
+    0x05, 0x09, 0x8C, 0x04, 0x78, 0xF3, 0xFC, 0x0F, 0x83, 0x07,  // 0xEA
+    0x05, 0x09, 0xF3, 0x0C, 0x78, 0xF3, 0xFC, 0x0F, 0x83, 0x07,  // 0xEB
+    0x05, 0x09, 0x06, 0x03, 0x3C, 0x0C, 0xC3, 0x30, 0xCC, 0x0F,  // 0xEC
+    0x05, 0x09, 0x18, 0x03, 0x3C, 0x0C, 0xC3, 0x30, 0xCC, 0x0F,  // 0xED
+    0x05, 0x09, 0x8C, 0x04, 0x3C, 0x0C, 0xC3, 0x30, 0xCC, 0x0F,  // 0xEE
+    0x05, 0x09, 0xF3, 0x0C, 0x3C, 0x0C, 0xC3, 0x30, 0xCC, 0x0F,  // 0xEF
+    0x05, 0x18, 0x36, 0xB3, 0xF1, 0xF3, 0x3C, 0xCF, 0x1E,  // 0xF0
+    0x05, 0x09, 0x66, 0x06, 0x7C, 0xF3, 0x3C, 0xCF, 0xF3, 0x0C,  // 0xF1
+    0x05, 0x09, 0x06, 0x03, 0x78, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xF2
+    0x05, 0x09, 0x18, 0x03, 0x78, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xF3
+    0x05, 0x09, 0x8C, 0x04, 0x78, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xF4
+    0x05, 0x09, 0x66, 0x06, 0x78, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xF5
+    0x05, 0x09, 0xF3, 0x0C, 0x78, 0xF3, 0x3C, 0xCF, 0xB3, 0x07,  // 0xF6
+    0x05, 0x26, 0x0C, 0x03, 0xFC, 0x00, 0xC3, 0x00,  // 0xF7
+    0x05, 0x36, 0xFE, 0xBC, 0xFF, 0xF7, 0xFC, 0x01,  // 0xF8
+    0x05, 0x09, 0x06, 0x03, 0xCC, 0xF3, 0x3C, 0xCF, 0xB3, 0x0F,  // 0xF9
+    0x05, 0x09, 0x18, 0x03, 0xCC, 0xF3, 0x3C, 0xCF, 0xB3, 0x0F,  // 0xFA
+    0x05, 0x09, 0xDE, 0x0C, 0xCC, 0xF3, 0x3C, 0xCF, 0xB3, 0x0F,  // 0xFB
+    0x05, 0x09, 0xF3, 0x0C, 0xCC, 0xF3, 0x3C, 0xCF, 0xB3, 0x0F,  // 0xFC
+    0x06, 0x0B, 0x30, 0x0C, 0xC0, 0x6C, 0x36, 0x9B, 0xCD, 0x3C, 0x18, 0xE6, 0x01,  // 0xFD
+    0x05, 0x0B, 0xC3, 0x30, 0x7C, 0xF3, 0x3C, 0xCF, 0xDF, 0x30, 0x0C,  // 0xFE
+    0x06, 0x0B, 0x66, 0x33, 0xC0, 0x6C, 0x36, 0x9B, 0xCD, 0x3C, 0x18, 0xE6, 0x01,  // 0xFF
+#endif
+};
+
+static const LCD_font Terminal8x12p =
+{
+#if defined(LCD_FONT_ASCII_ONLY)
+    9, 12, 0x20, 0x7E, 4, Terminal8x12p_bases, Terminal8x12p_offsets, Terminal8x12p_data, Terminal8x12p_advances
+#else
+    9, 12, 0x20, 0xFF, 4, Terminal8x12p_bases, Terminal8x12p_offsets, Terminal8x12p_data, Terminal8x12p_advances
+#endif
+};
+
+#endif